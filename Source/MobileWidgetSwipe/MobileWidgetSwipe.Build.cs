@@ -45,6 +45,9 @@ public class MobileWidgetSwipe : ModuleRules
 			);
 			
 		
+		// The soak commandlet paints without a GPU through the null Slate renderer
+		PrivateIncludePathModuleNames.Add("SlateNullRenderer");
+
 		// PrivateIncludePathModuleNames.AddRange(
 		// 	new string[] {
 		// 		"SlateRHIRenderer",
@@ -57,6 +60,8 @@ public class MobileWidgetSwipe : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
+				"Json",
+				"Projects",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -65,29 +70,15 @@ public class MobileWidgetSwipe : ModuleRules
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
+				"SlateNullRenderer",
 				// ... add any modules that your module loads dynamically here ...
 			}
 			);
 		
-		// Add slate runtime dependencies
+		// Stage the images used by the plugin style set, the Slate module stages the engine content it needs itself
 		if (Target.bUsesSlate)
 		{
-			RuntimeDependencies.Add("$(EngineDir)/Content/Slate/...*.ttf", StagedFileType.UFS);
-			RuntimeDependencies.Add("$(EngineDir)/Content/Slate/...*.png", StagedFileType.UFS);
-			RuntimeDependencies.Add("$(EngineDir)/Content/Slate/...*.svg", StagedFileType.UFS);
-			RuntimeDependencies.Add("$(EngineDir)/Content/Slate/...*.tps", StagedFileType.UFS);
-			RuntimeDependencies.Add("$(EngineDir)/Content/SlateDebug/...", StagedFileType.DebugNonUFS);
-
-			if (Target.Platform == UnrealTargetPlatform.Win64)
-			{ 
-				RuntimeDependencies.Add("$(EngineDir)/Content/Slate/...*.cur", StagedFileType.NonUFS);
-			}
-
-			if (Target.ProjectFile != null)
-			{
-				RuntimeDependencies.Add("$(ProjectDir)/Content/Slate/...", StagedFileType.UFS);
-				RuntimeDependencies.Add("$(ProjectDir)/Content/SlateDebug/...", StagedFileType.DebugNonUFS);
-			}
+			RuntimeDependencies.Add("$(PluginDir)/Resources/Slate/...*.png", StagedFileType.UFS);
 		}
 	}
 }
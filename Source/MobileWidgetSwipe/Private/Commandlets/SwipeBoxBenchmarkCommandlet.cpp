@@ -0,0 +1,318 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Commandlets/SwipeBoxBenchmarkCommandlet.h"
+
+#include "Algo/Accumulate.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/Border.h"
+#include "Components/TextBlock.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Math/RandomStream.h"
+#include "Serialization/JsonWriter.h"
+#include "Slate/Widgets/Layout/SSwipeBox.h"
+#include "UMG/Components/SwipeBox.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SwipeBoxBenchmarkCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogSwipeBoxBenchmark, Log, All);
+
+USwipeBoxBenchmarkCommandlet::USwipeBoxBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USwipeBoxBenchmarkCommandlet::Main(const FString& Params)
+{
+	// Commandlets do not create the Slate application, the core style is enough to construct widgets.
+	if (!FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::InitializeCoreStyle();
+	}
+
+	FString PagesParam = TEXT("10,100,1000");
+	FParse::Value(*Params, TEXT("Pages="), PagesParam);
+
+	int32 NumIterations = 20;
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	FString ReportFile = FPaths::ProfilingDir() / TEXT("SwipeBox") / FString::Printf(TEXT("Benchmark-%s.json"), *FDateTime::Now().ToString());
+	FParse::Value(*Params, TEXT("Report="), ReportFile);
+
+	TArray<FString> PageCounts;
+	PagesParam.ParseIntoArray(PageCounts, TEXT(","));
+
+	TArray<FCaseResult> Results;
+	for (const FString& PageCount : PageCounts)
+	{
+		const int32 NumPages = FCString::Atoi(*PageCount);
+		if (NumPages <= 0)
+		{
+			UE_LOG(LogSwipeBoxBenchmark, Error, TEXT("Invalid page count '%s'"), *PageCount);
+			return 1;
+		}
+
+		UE_LOG(LogSwipeBoxBenchmark, Display, TEXT("Running %d iterations with %d pages"), NumIterations, NumPages);
+		RunCases(NumPages, NumIterations, Results);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	FString StackChildrenParam = TEXT("1000,10000,100000");
+	FParse::Value(*Params, TEXT("StackChildren="), StackChildrenParam);
+
+	TArray<FString> StackChildCounts;
+	StackChildrenParam.ParseIntoArray(StackChildCounts, TEXT(","));
+
+	for (const FString& StackChildCount : StackChildCounts)
+	{
+		const int32 NumChildren = FCString::Atoi(*StackChildCount);
+		if (NumChildren <= 0)
+		{
+			UE_LOG(LogSwipeBoxBenchmark, Error, TEXT("Invalid stack child count '%s'"), *StackChildCount);
+			return 1;
+		}
+
+		UE_LOG(LogSwipeBoxBenchmark, Display, TEXT("Running %d iterations of the stack spans with %d children"),
+			NumIterations, NumChildren);
+		if (!RunStackSpanCases(NumChildren, NumIterations, Results))
+		{
+			return 1;
+		}
+	}
+
+	for (const FCaseResult& Result : Results)
+	{
+		const double Total = Algo::Accumulate(Result.SamplesMs, 0.0);
+		UE_LOG(LogSwipeBoxBenchmark, Display, TEXT("%-24s %6d pages: avg %8.3f ms, min %8.3f ms, max %8.3f ms"),
+			*Result.Name, Result.NumPages, Total / Result.SamplesMs.Num(),
+			FMath::Min(Result.SamplesMs), FMath::Max(Result.SamplesMs));
+	}
+
+	return WriteReport(ReportFile, Results) ? 0 : 1;
+}
+
+USwipeBoxBenchmarkPage* USwipeBoxBenchmarkCommandlet::CreatePage(UObject* Outer, int32 PageIndex) const
+{
+	USwipeBoxBenchmarkPage* Page = NewObject<USwipeBoxBenchmarkPage>(Outer, NAME_None, RF_Transient);
+	Page->Initialize();
+
+	UBorder* Border = Page->WidgetTree->ConstructWidget<UBorder>();
+	UTextBlock* Text = Page->WidgetTree->ConstructWidget<UTextBlock>();
+	Text->SetText(FText::AsNumber(PageIndex));
+	Border->SetContent(Text);
+	Page->WidgetTree->RootWidget = Border;
+
+	return Page;
+}
+
+void USwipeBoxBenchmarkCommandlet::RunCases(int32 NumPages, int32 NumIterations, TArray<FCaseResult>& OutResults) const
+{
+	auto AddCase = [&OutResults, NumPages](const TCHAR* Name) -> int32
+	{
+		FCaseResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.Name = Name;
+		Result.NumPages = NumPages;
+		return OutResults.Num() - 1;
+	};
+
+	const int32 ConstructCase = AddCase(TEXT("Construct"));
+	const int32 TakeWidgetCase = AddCase(TEXT("TakeWidget"));
+	const int32 SynchronizeCase = AddCase(TEXT("SynchronizeProperties"));
+	const int32 ChurnCase = AddCase(TEXT("AddRemoveChildChurn"));
+	const int32 RebuildCase = AddCase(TEXT("ReleaseAndRebuild"));
+	const int32 ReplaceCase = AddCase(TEXT("ReplaceChildrenLive"));
+
+	auto Measure = [&OutResults](int32 CaseIndex, TFunctionRef<void()> Function)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Function();
+		OutResults[CaseIndex].SamplesMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	};
+
+	UPackage* Outer = GetTransientPackage();
+	const int32 NumChurn = FMath::Min(NumPages, 32);
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		TArray<USwipeBoxBenchmarkPage*> Pages;
+		Pages.Reserve(NumPages);
+		for (int32 PageIndex = 0; PageIndex < NumPages; ++PageIndex)
+		{
+			Pages.Add(CreatePage(Outer, PageIndex));
+		}
+
+		USwipeBox* SwipeBox = nullptr;
+		Measure(ConstructCase, [&]()
+		{
+			SwipeBox = NewObject<USwipeBox>(Outer, NAME_None, RF_Transient);
+			for (USwipeBoxBenchmarkPage* Page : Pages)
+			{
+				SwipeBox->AddChild(Page);
+			}
+		});
+
+		Measure(TakeWidgetCase, [&]()
+		{
+			SwipeBox->TakeWidget();
+		});
+
+		Measure(SynchronizeCase, [&]()
+		{
+			SwipeBox->SynchronizeProperties();
+		});
+
+		Measure(ChurnCase, [&]()
+		{
+			for (int32 ChurnIndex = 0; ChurnIndex < NumChurn; ++ChurnIndex)
+			{
+				UWidget* Child = SwipeBox->GetChildAt(SwipeBox->GetChildrenCount() - 1);
+				SwipeBox->RemoveChild(Child);
+				SwipeBox->AddChild(Child);
+			}
+		});
+
+		Measure(RebuildCase, [&]()
+		{
+			SwipeBox->ReleaseSlateResources(true);
+			SwipeBox->TakeWidget();
+		});
+
+		const TArray<UWidget*> Children(Pages);
+		Measure(ReplaceCase, [&]()
+		{
+			SwipeBox->ReplaceChildren(Children);
+		});
+
+		SwipeBox->ReleaseSlateResources(true);
+		SwipeBox->ClearChildren();
+		SwipeBox->MarkAsGarbage();
+		for (USwipeBoxBenchmarkPage* Page : Pages)
+		{
+			Page->MarkAsGarbage();
+		}
+	}
+}
+
+bool USwipeBoxBenchmarkCommandlet::RunStackSpanCases(int32 NumChildren, int32 NumIterations,
+                                                     TArray<FCaseResult>& OutResults) const
+{
+	// Thumbnails of a free scrolling strip: mostly auto sized, some stretched, clamped or collapsed.
+	FRandomStream Random(NumChildren);
+	SSwipePanel::FStackLayoutInputs Inputs;
+	Inputs.Visibilities.Reserve(NumChildren);
+	for (int32 ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+	{
+		const bool bStretch = Random.FRand() < 0.1f;
+		const bool bVisible = Random.FRand() >= 0.05f;
+		Inputs.Visibilities.Add(bVisible ? EVisibility::Visible : EVisibility::Collapsed);
+		Inputs.DesiredSizes.Add(FVector2f(Random.FRandRange(32.f, 128.f), 64.f));
+		Inputs.Paddings.Add(FMargin(Random.FRandRange(0.f, 4.f), 0.f));
+		Inputs.SizeRules.Add(bStretch ? FSizeParam::SizeRule_Stretch : FSizeParam::SizeRule_Auto);
+		Inputs.SizeValues.Add(bStretch ? Random.FRandRange(0.5f, 2.f) : 1.f);
+		Inputs.MaxSizes.Add(Random.FRand() < 0.2f ? 96.f : 0.f);
+		Inputs.SizesAlong.Add(Inputs.DesiredSizes.Last().X);
+		Inputs.PaddingsAlong.Add(Inputs.Paddings.Last().GetTotalSpaceAlong<Orient_Horizontal>());
+		Inputs.StretchFlags.Add(bStretch ? 1.f : 0.f);
+		Inputs.VisibleFlags.Add(bVisible ? 1.f : 0.f);
+	}
+
+	const float AllottedSize = 1920.f;
+	const SSwipePanel::FStackTotals Totals = SSwipePanel::ComputeStackTotals(Inputs, AllottedSize, false);
+	const float NonFixedSpace = SSwipePanel::ComputeNonFixedSpace(Totals, AllottedSize, false);
+
+	// One call is too short to time on its own with the smaller counts, every sample runs enough of them.
+	const int32 NumRepeats = FMath::Max(1, 1000000 / NumChildren);
+
+	double ScalarTotal = 0.0;
+	double VectorizedTotal = 0.0;
+	TArray<double> ScalarStarts;
+	for (const bool bVectorized : {false, true})
+	{
+		FCaseResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.Name = bVectorized ? TEXT("StackSpansVectorized") : TEXT("StackSpansScalar");
+		Result.NumPages = NumChildren;
+
+		double& Total = bVectorized ? VectorizedTotal : ScalarTotal;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+			{
+				Total = SSwipePanel::ComputeChildSpans(Inputs, NonFixedSpace, Totals.StretchCoefficientTotal, false,
+				                                       false, bVectorized);
+			}
+			Result.SamplesMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0 / NumRepeats);
+		}
+
+		if (!bVectorized)
+		{
+			ScalarStarts = Inputs.Starts;
+		}
+	}
+
+	// The vectorized path sums four extents in float before adding them to the double total.
+	const double Tolerance = 1e-5 * FMath::Max(ScalarTotal, 1.0);
+	for (int32 ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+	{
+		if (FMath::Abs(ScalarStarts[ChildIndex] - Inputs.Starts[ChildIndex]) > Tolerance)
+		{
+			UE_LOG(LogSwipeBoxBenchmark, Error, TEXT("Child %d starts at %f with the scalar spans and at %f vectorized"),
+				ChildIndex, ScalarStarts[ChildIndex], Inputs.Starts[ChildIndex]);
+			return false;
+		}
+	}
+	if (FMath::Abs(ScalarTotal - VectorizedTotal) > Tolerance)
+	{
+		UE_LOG(LogSwipeBoxBenchmark, Error, TEXT("The stack is %f long with the scalar spans and %f vectorized"),
+			ScalarTotal, VectorizedTotal);
+		return false;
+	}
+	return true;
+}
+
+bool USwipeBoxBenchmarkCommandlet::WriteReport(const FString& FileName, const TArray<FCaseResult>& Results) const
+{
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Platform"), FString(FPlatformProperties::IniPlatformName()));
+	Writer->WriteValue(TEXT("Configuration"), FString(LexToString(FApp::GetBuildConfiguration())));
+	Writer->WriteArrayStart(TEXT("Cases"));
+	for (const FCaseResult& Result : Results)
+	{
+		TArray<double> Sorted = Result.SamplesMs;
+		Sorted.Sort();
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Name"), Result.Name);
+		Writer->WriteValue(TEXT("NumPages"), Result.NumPages);
+		Writer->WriteValue(TEXT("Iterations"), Sorted.Num());
+		Writer->WriteValue(TEXT("MinMs"), Sorted[0]);
+		Writer->WriteValue(TEXT("MedianMs"), Sorted[Sorted.Num() / 2]);
+		Writer->WriteValue(TEXT("AvgMs"), Algo::Accumulate(Sorted, 0.0) / Sorted.Num());
+		Writer->WriteValue(TEXT("MaxMs"), Sorted.Last());
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(Json, *FileName))
+	{
+		UE_LOG(LogSwipeBoxBenchmark, Error, TEXT("Unable to write the report to %s"), *FileName);
+		return false;
+	}
+
+	UE_LOG(LogSwipeBoxBenchmark, Display, TEXT("Report written to %s"), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*FileName));
+	return true;
+}
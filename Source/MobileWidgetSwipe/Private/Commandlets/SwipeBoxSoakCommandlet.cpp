@@ -0,0 +1,568 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Commandlets/SwipeBoxSoakCommandlet.h"
+
+#include "Containers/Ticker.h"
+
+#include "Components/Spacer.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/ISlateNullRendererModule.h"
+#include "Layout/ArrangedChildren.h"
+#include "Misc/ScopeExit.h"
+#include "Modules/ModuleManager.h"
+#include "Rendering/DrawElements.h"
+#include "Slate/Widgets/Layout/SSwipeBox.h"
+#include "UMG/Components/SwipeBox.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectArray.h"
+#include "Widgets/Layout/SSpacer.h"
+#include "Widgets/SWindow.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SwipeBoxSoakCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogSwipeBoxSoak, Log, All);
+
+namespace SwipeBoxSoakPrivate
+{
+	/** Size of the simulated viewport and of every page. */
+	const FVector2f PageSize(400.f, 800.f);
+
+	/** The Slate box never holds more pages than this. */
+	constexpr int32 MaxSlatePages = 16;
+
+	/** The Slate box is cleared every ClearInterval iterations. */
+	constexpr int32 ClearInterval = 100;
+
+	/** The UMG box is rebuilt every RebuildInterval iterations. */
+	constexpr int32 RebuildInterval = 50;
+
+	/** Number of children of the UMG box. */
+	constexpr int32 NumUMGPages = 8;
+
+	/** Frames a time sliced UMG box builds pages for before some of its children are removed. */
+	constexpr int32 TimeSliceFrames = 2;
+
+	/** Pages of the box swiped by the allocation count. */
+	constexpr int32 NumSwipePages = 6;
+
+	/** Frames of one swipe of the allocation count, the first DragFrames follow the finger and the rest settle. */
+	constexpr int32 GestureFrames = 40;
+	constexpr int32 DragFrames = 12;
+
+	/** Deepest widget the allocation count arranges. */
+	constexpr int32 MaxArrangeDepth = 16;
+
+	/** Forwards to the allocator it wraps, counting the allocations of the game thread. */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// A reallocation to zero bytes is a free.
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			InnerMalloc->Free(Original);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return InnerMalloc->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return InnerMalloc->QuantizeSize(Count, Alignment);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			InnerMalloc->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return InnerMalloc->IsInternallyThreadSafe();
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return InnerMalloc->ValidateHeap();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return InnerMalloc->GetDescriptiveName();
+		}
+
+		FMalloc* GetInnerMalloc() const
+		{
+			return InnerMalloc;
+		}
+
+		void StartCounting()
+		{
+			NumAllocations = 0;
+			bCounting = true;
+		}
+
+		int32 StopCounting()
+		{
+			bCounting = false;
+			return NumAllocations;
+		}
+
+	private:
+		void CountAllocation()
+		{
+			// Only the game thread writes the count, the other threads keep allocating through this proxy unseen.
+			if (bCounting && IsInGameThread())
+			{
+				++NumAllocations;
+			}
+		}
+
+		FMalloc* InnerMalloc;
+		int32 NumAllocations = 0;
+		bool bCounting = false;
+	};
+
+	/** Arranges Widget and its descendants the way a paint pass would, into buffers reused from frame to frame. */
+	void ArrangeDescendants(const SWidget& Widget, const FGeometry& Geometry, TArray<FArrangedChildren>& ArrangedLevels,
+	                        int32 Depth = 0)
+	{
+		if (!ArrangedLevels.IsValidIndex(Depth))
+		{
+			return;
+		}
+
+		FArrangedChildren& ArrangedChildren = ArrangedLevels[Depth];
+		ArrangedChildren.GetInternalArray().Reset();
+		Widget.ArrangeChildren(Geometry, ArrangedChildren);
+		for (int32 ChildIndex = 0; ChildIndex < ArrangedChildren.Num(); ++ChildIndex)
+		{
+			const FArrangedWidget& Child = ArrangedChildren[ChildIndex];
+			ArrangeDescendants(Child.Widget.Get(), Child.Geometry, ArrangedLevels, Depth + 1);
+		}
+	}
+}
+
+USwipeBoxSoakCommandlet::USwipeBoxSoakCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USwipeBoxSoakCommandlet::Main(const FString& Params)
+{
+	using namespace SwipeBoxSoakPrivate;
+
+	// Page changes register active timers, which needs the Slate application and not only the core style.
+	const bool bCreateSlateApplication = !FSlateApplication::IsInitialized();
+	if (bCreateSlateApplication)
+	{
+		FSlateApplication::InitializeCoreStyle();
+		FSlateApplication::Create();
+	}
+	ON_SCOPE_EXIT
+	{
+		if (bCreateSlateApplication)
+		{
+			FSlateApplication::Shutdown();
+		}
+	};
+
+	// Active timers only run when the widgets are painted, without a GPU the paint goes to the null renderer.
+	if (FSlateApplication::Get().GetRenderer() == nullptr)
+	{
+		ISlateNullRendererModule& NullRendererModule =
+			FModuleManager::LoadModuleChecked<ISlateNullRendererModule>("SlateNullRenderer");
+		FSlateApplication::Get().InitializeRenderer(NullRendererModule.CreateSlateNullRenderer());
+	}
+
+	if (FParse::Param(*Params, TEXT("CountAllocations")))
+	{
+#if PLATFORM_USES_FIXED_GMalloc_CLASS
+		UE_LOG(LogSwipeBoxSoak, Warning, TEXT("This platform allocates without going through GMalloc, nothing to count"));
+		return 0;
+#else
+		int32 NumFrames = 1000;
+		FParse::Value(*Params, TEXT("Frames="), NumFrames);
+		NumFrames = FMath::Max(NumFrames, 1);
+
+		const int32 NumAllocations = CountSwipeAllocations(NumFrames);
+		if (NumAllocations > 0)
+		{
+			UE_LOG(LogSwipeBoxSoak, Error, TEXT("Swiping allocated %d times over %d frames, expected none"),
+				NumAllocations, NumFrames);
+			return 1;
+		}
+		UE_LOG(LogSwipeBoxSoak, Display, TEXT("Swiping did not allocate over %d frames"), NumFrames);
+		return 0;
+#endif
+	}
+
+	int32 NumIterations = 100000;
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+
+	int32 SampleInterval = 1000;
+	FParse::Value(*Params, TEXT("SampleInterval="), SampleInterval);
+	SampleInterval = FMath::Max(SampleInterval, 1);
+
+	float MaxGrowthMB = 16.f;
+	FParse::Value(*Params, TEXT("MaxGrowthMB="), MaxGrowthMB);
+
+	int32 MaxObjectGrowth = 64;
+	FParse::Value(*Params, TEXT("MaxObjectGrowth="), MaxObjectGrowth);
+
+	TSharedPtr<SSwipeBox> SlateSwipeBox = SNew(SSwipeBox).Orientation(Orient_Horizontal);
+	TArray<TSharedRef<SWidget>> SlatePages;
+
+	// Hosts the Slate box so painting it runs its active timers. Never added to the application, no OS window is made.
+	TSharedPtr<SWindow> SlateWindow = SNew(SWindow)
+		.ClientSize(FVector2D(PageSize))
+		.CreateTitleBar(false)
+		.SizingRule(ESizingRule::FixedSize)
+		[
+			SlateSwipeBox.ToSharedRef()
+		];
+
+	USwipeBox* UMGSwipeBox = NewObject<USwipeBox>(GetTransientPackage(), NAME_None, RF_Transient);
+	UMGSwipeBox->AddToRoot();
+
+	TArray<FSample> Samples;
+	bool bRemovalFailed = false;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		RunSlateIteration(*SlateWindow, *SlateSwipeBox, SlatePages, Iteration);
+
+		if (Iteration % RebuildInterval == 0 && !RunUMGIteration(*UMGSwipeBox, Iteration))
+		{
+			bRemovalFailed = true;
+		}
+
+		if ((Iteration + 1) % SampleInterval == 0)
+		{
+			const FSample& Sample = Samples.Add_GetRef(TakeSample(Iteration + 1));
+			UE_LOG(LogSwipeBoxSoak, Display, TEXT("%8d iterations: %.2f MB used, %d objects, %d live swipe boxes"),
+				Sample.Iteration, Sample.UsedMemory / (1024.0 * 1024.0), Sample.NumObjects, Sample.NumSwipeBoxes);
+		}
+	}
+
+	UMGSwipeBox->ReleaseSlateResources(true);
+	UMGSwipeBox->RemoveFromRoot();
+
+	// Nothing should keep a swipe box alive once its owners let go of it.
+	SlateSwipeBox->ClearChildren();
+	SlatePages.Reset();
+	SlateWindow.Reset();
+	SlateSwipeBox.Reset();
+	USwipeBox::FlushPageTeardown();
+	const int32 NumLeakedSwipeBoxes = TakeSample(NumIterations).NumSwipeBoxes;
+
+	// The first sample absorbs one-off allocations (caches, pools) and is not part of the trend.
+	if (Samples.Num() > 1)
+	{
+		Samples.RemoveAt(0);
+	}
+
+	TArray<double> Memory;
+	TArray<double> Objects;
+	TArray<double> SwipeBoxes;
+	for (const FSample& Sample : Samples)
+	{
+		Memory.Add(static_cast<double>(Sample.UsedMemory));
+		Objects.Add(Sample.NumObjects);
+		SwipeBoxes.Add(Sample.NumSwipeBoxes);
+	}
+
+	bool bFailed = bRemovalFailed;
+	if (IsGrowingMonotonically(Memory, MaxGrowthMB * 1024.0 * 1024.0))
+	{
+		UE_LOG(LogSwipeBoxSoak, Error, TEXT("Used memory grew steadily from %.2f MB to %.2f MB"),
+			Memory[0] / (1024.0 * 1024.0), Memory.Last() / (1024.0 * 1024.0));
+		bFailed = true;
+	}
+	if (IsGrowingMonotonically(Objects, MaxObjectGrowth))
+	{
+		UE_LOG(LogSwipeBoxSoak, Error, TEXT("UObject count grew steadily from %d to %d"),
+			static_cast<int32>(Objects[0]), static_cast<int32>(Objects.Last()));
+		bFailed = true;
+	}
+	if (IsGrowingMonotonically(SwipeBoxes, 0.0))
+	{
+		UE_LOG(LogSwipeBoxSoak, Error, TEXT("Live swipe box count grew steadily from %d to %d"),
+			static_cast<int32>(SwipeBoxes[0]), static_cast<int32>(SwipeBoxes.Last()));
+		bFailed = true;
+	}
+	if (NumLeakedSwipeBoxes > 0)
+	{
+		UE_LOG(LogSwipeBoxSoak, Error, TEXT("%d swipe boxes are still alive after releasing every box"),
+			NumLeakedSwipeBoxes);
+		bFailed = true;
+	}
+
+	if (!bFailed)
+	{
+		UE_LOG(LogSwipeBoxSoak, Display, TEXT("No steady growth detected over %d iterations"), NumIterations);
+	}
+	return bFailed ? 1 : 0;
+}
+
+void USwipeBoxSoakCommandlet::RunSlateIteration(SWindow& Window, SSwipeBox& SwipeBox,
+                                                TArray<TSharedRef<SWidget>>& Pages, int32 Iteration) const
+{
+	using namespace SwipeBoxSoakPrivate;
+
+	const bool bAnimate = Iteration % 2 == 0;
+
+	TSharedRef<SWidget> Page = SNew(SSpacer).Size(FVector2D(PageSize));
+	SwipeBox.AddSlot()
+	[
+		Page
+	];
+	Pages.Add(Page);
+
+	if (Pages.Num() > MaxSlatePages)
+	{
+		// Ask to swipe to a page that is removed before the request runs, it must not keep the page alive.
+		SwipeBox.SwipeDescendantIntoView(Pages[0], bAnimate);
+		SwipeBox.RemoveSlot(Pages[0]);
+		Pages.RemoveAt(0);
+	}
+
+	SwipeBox.SetCurrentPage(Iteration % Pages.Num(), false, bAnimate);
+
+	// Painting ticks the box and runs its active timers (inertial swipe, sticky snap), like a frame of the application.
+	FSlateWindowElementList WindowElements(StaticCastSharedRef<SWindow>(Window.AsShared()));
+	Window.SlatePrepass(1.f);
+	Window.PaintWindow(Iteration / 60.0, 1.f / 60.f, WindowElements, FWidgetStyle(), true);
+	SwipeBox.EndInertialSwipeing();
+
+	if (Iteration % ClearInterval == ClearInterval - 1)
+	{
+		SwipeBox.ClearChildren();
+		Pages.Reset();
+	}
+}
+
+bool USwipeBoxSoakCommandlet::RunUMGIteration(USwipeBox& SwipeBox, int32 Iteration) const
+{
+	using namespace SwipeBoxSoakPrivate;
+
+	SwipeBox.ReleaseSlateResources(true);
+	SwipeBox.ClearChildren();
+	// Every other rebuild builds its pages over frames, mixing built pages and placeholders in the live box.
+	SwipeBox.SetTimeSlicePageBuild(Iteration / RebuildInterval % 2 == 1);
+
+	for (int32 PageIndex = 0; PageIndex < NumUMGPages; ++PageIndex)
+	{
+		USpacer* Spacer = NewObject<USpacer>(&SwipeBox, NAME_None, RF_Transient);
+		Spacer->SetSize(FVector2D(PageSize));
+		SwipeBox.AddChild(Spacer);
+	}
+
+	const TSharedRef<SSwipeBox> SlateSwipeBox = StaticCastSharedRef<SSwipeBox>(SwipeBox.TakeWidget());
+	SwipeBox.SetCurrentPage(Iteration % NumUMGPages, false, Iteration % 2 == 0);
+	SwipeBox.SwipeWidgetIntoView(SwipeBox.GetChildAt(NumUMGPages - 1), true);
+
+	if (!SwipeBox.IsTimeSlicePageBuild())
+	{
+		return true;
+	}
+
+	// Build some of the pages, then remove every other child: built pages must leave the Slate box as well.
+	for (int32 Frame = 0; Frame < TimeSliceFrames; ++Frame)
+	{
+		FTSTicker::GetCoreTicker().Tick(1.f / 60.f);
+	}
+	TArray<UWidget*> RemovedChildren;
+	for (int32 ChildIndex = 0; ChildIndex < SwipeBox.GetChildrenCount(); ChildIndex += 2)
+	{
+		RemovedChildren.Add(SwipeBox.GetChildAt(ChildIndex));
+	}
+	SwipeBox.RemoveChildren(RemovedChildren);
+
+	if (SlateSwipeBox->GetNumSlots() != SwipeBox.GetChildrenCount())
+	{
+		UE_LOG(LogSwipeBoxSoak, Error, TEXT("Iteration %d: the Slate box kept %d slots for %d time sliced children"),
+			Iteration, SlateSwipeBox->GetNumSlots(), SwipeBox.GetChildrenCount());
+		return false;
+	}
+	return true;
+}
+
+USwipeBoxSoakCommandlet::FSample USwipeBoxSoakCommandlet::TakeSample(int32 Iteration) const
+{
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	FSample Sample;
+	Sample.Iteration = Iteration;
+	Sample.UsedMemory = FPlatformMemory::GetStats().UsedPhysical;
+	Sample.NumObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	SSwipeBox::ForEachLiveInstance([&Sample](SSwipeBox&)
+	{
+		++Sample.NumSwipeBoxes;
+	});
+	return Sample;
+}
+
+int32 USwipeBoxSoakCommandlet::CountSwipeAllocations(int32 NumFrames) const
+{
+	using namespace SwipeBoxSoakPrivate;
+
+	// Even gestures are touch drags, the box takes the touches as captured since there is no window to capture the
+	// pointer. Odd gestures drag with the wheel.
+	TSharedRef<SSwipeBox> SwipeBox = SNew(SSwipeBox)
+		.Orientation(Orient_Horizontal)
+		.ConsumeMouseWheel(EConsumeMouseWheel::Always);
+	SwipeBox->SetAssumeTouchCaptureForTesting(true);
+	for (int32 PageIndex = 0; PageIndex < NumSwipePages; ++PageIndex)
+	{
+		SwipeBox->AddSlot()
+		[
+			SNew(SSpacer).Size(FVector2D(PageSize))
+		];
+	}
+
+	const FGeometry Geometry = FGeometry::MakeRoot(PageSize, FSlateLayoutTransform());
+	const TSet<FKey> NoPressedButtons;
+	const FPointerEvent DragForward(FSlateApplication::CursorPointerIndex, FVector2f(PageSize * 0.5f),
+	                                FVector2f(PageSize * 0.5f), NoPressedButtons, EKeys::MouseWheelAxis, -1.f,
+	                                FModifierKeysState());
+	const FPointerEvent DragBackward(FSlateApplication::CursorPointerIndex, FVector2f(PageSize * 0.5f),
+	                                 FVector2f(PageSize * 0.5f), NoPressedButtons, EKeys::MouseWheelAxis, 1.f,
+	                                 FModifierKeysState());
+
+	TArray<FArrangedChildren> ArrangedLevels;
+	for (int32 Depth = 0; Depth < MaxArrangeDepth; ++Depth)
+	{
+		ArrangedLevels.Emplace(EVisibility::Visible);
+	}
+
+	// Half a page over the drag frames, each move is past the drag trigger distance.
+	const float TouchStep = PageSize.X * 0.5f / DragFrames;
+	const uint32 TouchUserIndex = 0;
+	const uint32 TouchPointerIndex = 0;
+	FVector2f TouchPosition = PageSize * 0.5f;
+
+	int32 Page = 0;
+	int32 Direction = 1;
+	const auto RunFrame = [&](int32 Frame)
+	{
+		const int32 GestureFrame = Frame % GestureFrames;
+		const bool bTouchGesture = Frame / GestureFrames % 2 == 0;
+		if (GestureFrame == 0 && !FMath::IsWithin(Page + Direction, 0, NumSwipePages))
+		{
+			Direction = -Direction;
+		}
+
+		if (bTouchGesture && GestureFrame == 0)
+		{
+			TouchPosition = PageSize * 0.5f;
+			SwipeBox->OnPreviewMouseButtonDown(Geometry, FPointerEvent(TouchUserIndex, TouchPointerIndex, TouchPosition,
+			                                                           TouchPosition, 1.f, true));
+		}
+		else if (bTouchGesture && GestureFrame < DragFrames)
+		{
+			// The finger moves against the swipe direction.
+			const FVector2f LastTouchPosition = TouchPosition;
+			TouchPosition.X -= Direction * TouchStep;
+			SwipeBox->OnMouseMove(Geometry, FPointerEvent(TouchUserIndex, TouchPointerIndex, TouchPosition,
+			                                              LastTouchPosition, 1.f, true));
+		}
+		else if (!bTouchGesture && GestureFrame < DragFrames)
+		{
+			SwipeBox->OnMouseWheel(Geometry, Direction > 0 ? DragForward : DragBackward);
+		}
+		else if (GestureFrame == DragFrames)
+		{
+			if (bTouchGesture)
+			{
+				SwipeBox->OnTouchEnded(Geometry, FPointerEvent(TouchUserIndex, TouchPointerIndex, TouchPosition,
+				                                               TouchPosition, 0.f, false));
+				// What Slate sends once the capture of the released touch is gone.
+				SwipeBox->OnMouseCaptureLost(FCaptureLostEvent(TouchUserIndex, TouchPointerIndex));
+			}
+			Page += Direction;
+			SwipeBox->SetCurrentPage(Page, true, true);
+		}
+
+		SwipeBox->SlatePrepass(1.f);
+		SwipeBox->Tick(Geometry, Frame / 60.0, 1.f / 60.f);
+		ArrangeDescendants(SwipeBox.Get(), Geometry, ArrangedLevels);
+	};
+
+	// Two round trips over the pages size every buffer the swipe reuses, and register the inertial swipe timer.
+	const int32 NumWarmUpFrames = 4 * (NumSwipePages - 1) * GestureFrames;
+	for (int32 Frame = 0; Frame < NumWarmUpFrames; ++Frame)
+	{
+		RunFrame(Frame);
+	}
+
+	// Kept alive for good, another thread may still be inside it after GMalloc is restored.
+	static FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+	check(CountingMalloc->GetInnerMalloc() == GMalloc);
+
+	GMalloc = CountingMalloc;
+	CountingMalloc->StartCounting();
+	for (int32 Frame = NumWarmUpFrames; Frame < NumWarmUpFrames + NumFrames; ++Frame)
+	{
+		RunFrame(Frame);
+	}
+	const int32 NumAllocations = CountingMalloc->StopCounting();
+	GMalloc = CountingMalloc->GetInnerMalloc();
+
+	return NumAllocations;
+}
+
+bool USwipeBoxSoakCommandlet::IsGrowingMonotonically(const TArray<double>& Values, double Threshold)
+{
+	if (Values.Num() < 3)
+	{
+		return false;
+	}
+
+	int32 NumDecreases = 0;
+	for (int32 Index = 1; Index < Values.Num(); ++Index)
+	{
+		if (Values[Index] < Values[Index - 1])
+		{
+			++NumDecreases;
+		}
+	}
+
+	const int32 NumSteps = Values.Num() - 1;
+	return NumDecreases <= NumSteps / 10 && Values.Last() - Values[0] > Threshold;
+}
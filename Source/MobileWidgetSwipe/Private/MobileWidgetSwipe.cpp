@@ -3,6 +3,7 @@
 #include "MobileWidgetSwipe.h"
 
 #include "WidgetSwipeStyle.h"
+#include "UMG/Components/SwipeBox.h"
 
 #define LOCTEXT_NAMESPACE "FMobileWidgetSwipeModule"
 
@@ -10,20 +11,23 @@ void FMobileWidgetSwipeModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 
-	FWidgetSwipeStyle::Initialize();
-
+	// The Slate style set is created by the first swipe box, only the editor needs the class icons up front.
+#if WITH_EDITOR
+	if (GIsEditor)
+	{
+		FWidgetSwipeStyle::Initialize();
+	}
+#endif
 }
 
 void FMobileWidgetSwipeModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
-	#if WITH_EDITOR
-	if (GIsEditor)
-	{
-		FWidgetSwipeStyle::Shutdown();
-	}
-#endif
+	USwipeBox::FlushPageTeardown();
+
+	// The Slate style set may have been created by a game, not only by the editor startup.
+	FWidgetSwipeStyle::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
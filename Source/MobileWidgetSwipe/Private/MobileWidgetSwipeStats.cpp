@@ -0,0 +1,5 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MobileWidgetSwipeStats.h"
+
+LLM_DEFINE_TAG(MobileWidgetSwipe, NAME_None, TEXT("UI"));
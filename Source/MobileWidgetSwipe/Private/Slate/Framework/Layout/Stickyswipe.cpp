@@ -16,7 +16,7 @@ FStickyswipe::FStickyswipe()
 	  Looseness(200),
 	  Orientation(),
 	  LastAllottedGeometry(nullptr),
-	  StickyswipeAmount(0.0f),
+	  StickyswipeAmount(0.0),
 	  StickyswipeAmountStart(0),
 	  AlphaTarget(0),
 	  SwipeAmountSinceUserMove(0),
@@ -31,7 +31,7 @@ float FStickyswipe::SwipeBy(const FGeometry& AllottedGeometry, float LocalDeltaS
 	UserSwiped = true;
 	const float ScreenDeltaSwipe = LocalDeltaScroll / AllottedGeometry.Scale;
 
-	const float ValueBeforeDeltaApplied = StickyswipeAmount;
+	const double ValueBeforeDeltaApplied = StickyswipeAmount;
 	StickyswipeAmount += ScreenDeltaSwipe;
 
 	SwipeAmountSinceUserMove += LocalDeltaScroll;
@@ -43,13 +43,13 @@ float FStickyswipe::SwipeBy(const FGeometry& AllottedGeometry, float LocalDeltaS
 		TargetPoint = GetPageSwipeValue(&AllottedGeometry, CurrentPageId);
 	}
 
-	return ValueBeforeDeltaApplied - StickyswipeAmount;
+	return static_cast<float>(ValueBeforeDeltaApplied - StickyswipeAmount);
 }
 
 // Code used in tick to get the effective offset in the component to display
-float FStickyswipe::GetStickyswipe(const FGeometry& AllottedGeometry) const
+double FStickyswipe::GetStickyswipe(const FGeometry& AllottedGeometry) const
 {
-	float EffectiveSwipe;
+	double EffectiveSwipe;
 
 	switch (CurrentMode)
 	{
@@ -81,17 +81,17 @@ float FStickyswipe::GetStickyswipe(const FGeometry& AllottedGeometry) const
 		break;
 	}
 
-	EffectiveSwipe = FMath::Clamp(EffectiveSwipe, 0, MaxValue);
+	EffectiveSwipe = FMath::Clamp(EffectiveSwipe, 0.0, MaxValue);
 	return EffectiveSwipe;
 }
 
 // Code used in tick after the GetStickyswipe to update values if an animation is present
-bool FStickyswipe::UpdateStickyswipe(const TSharedRef<SPanel> Panel, const FGeometry& AllottedGeometry,
-                                     float InDeltaTime)
+bool FStickyswipe::UpdateStickyswipe(SPanel& Panel, const FGeometry& AllottedGeometry, float InDeltaTime)
 {
 	bool SwipeValidated = false;
-	const auto Children = Panel->GetChildren();
+	const FChildren* Children = Panel.GetChildren();
 	LastAllottedGeometry = &AllottedGeometry;
+	PageSwipeStep = GetPageSwipeValue(&AllottedGeometry, 1);
 
 	if (Children->Num() < 1)
 	{
@@ -115,11 +115,10 @@ bool FStickyswipe::UpdateStickyswipe(const TSharedRef<SPanel> Panel, const FGeom
 		// If the user released the interraction, compute the page swipe logic
 		if (FunctionSwiped)
 		{
-			TSharedRef<SWidget> Widget = Children->GetChildAt(CurrentPageId);
 			if (FunctionSwipedWithAnimation)
 			{
 				CurrentMode = EStickyMode::StickyToTarget;
-				float NewStickyswipeAmount = GetStickyswipe(AllottedGeometry);
+				const double NewStickyswipeAmount = GetStickyswipe(AllottedGeometry);
 				TargetPoint = GetPageSwipeValue(&AllottedGeometry, CurrentPageId);
 
 				StickyswipeAmount = NewStickyswipeAmount;
@@ -138,14 +137,13 @@ bool FStickyswipe::UpdateStickyswipe(const TSharedRef<SPanel> Panel, const FGeom
 			}
 		} else if (FMath::Abs(SwipeAmountSinceUserMove) > Size * ScreenPercentDistanceUserChangePage)
 		{
-			float NewStickyswipeAmount = GetStickyswipe(AllottedGeometry);
+			const double NewStickyswipeAmount = GetStickyswipe(AllottedGeometry);
 			CurrentMode = EStickyMode::StickyToTarget;
 
 			int NewCurrentPageId = SwipeAmountSinceUserMove > 0 ? CurrentPageId + 1 : CurrentPageId - 1;
 			NewCurrentPageId = FMath::Clamp(NewCurrentPageId, 0, LastChildId);
 			CurrentPageId = NewCurrentPageId;
-			
-			TSharedRef<SWidget> Widget = Children->GetChildAt(CurrentPageId);
+
 			StickyswipeAmount = NewStickyswipeAmount;
 			StickyswipeAmountStart = StickyswipeAmount;
 			AlphaTarget = 0;
@@ -201,7 +199,7 @@ bool FStickyswipe::UpdateStickyswipe(const TSharedRef<SPanel> Panel, const FGeom
 	}
 
 	MaxValue = GetPageSwipeValue(&AllottedGeometry, LastChildId);
-	StickyswipeAmount = FMath::Clamp(StickyswipeAmount, 0, MaxValue);
+	StickyswipeAmount = FMath::Clamp(StickyswipeAmount, 0.0, MaxValue);
 
 
 	if (UserSwipeEnd)
@@ -229,15 +227,15 @@ bool FStickyswipe::ShouldApplyStickyswipe() const
 
 void FStickyswipe::ResetStickyswipe()
 {
-	StickyswipeAmount = 0.0f;
+	StickyswipeAmount = 0.0;
 }
 
-float FStickyswipe::GetPageSwipeValue(const FGeometry* AllottedGeometry, int PageId) const
+double FStickyswipe::GetPageSwipeValue(const FGeometry* AllottedGeometry, int PageId) const
 {
 	switch (Orientation)
 	{
-	case Orient_Horizontal: return AllottedGeometry->Size.X * PageId - PageId;
-	case Orient_Vertical: return AllottedGeometry->Size.Y * PageId - PageId;
+	case Orient_Horizontal: return static_cast<double>(AllottedGeometry->Size.X) * PageId - PageId;
+	case Orient_Vertical: return static_cast<double>(AllottedGeometry->Size.Y) * PageId - PageId;
 	default: return 0;
 	}
 }
@@ -250,7 +248,28 @@ void FStickyswipe::SetCurrentPage(int NewPage, bool ThrowEvent, bool PlayAnimati
 	FunctionSwipedThrowEvent = ThrowEvent;
 }
 
-float FStickyswipe::GetDistanceFromEnd() const
+void FStickyswipe::RebaseCurrentPage(int NewPage, int NumPages)
+{
+	LastChildId = NumPages - 1;
+	NewPage = FMath::Clamp(NewPage, 0, FMath::Max(LastChildId, 0));
+
+	if (PageSwipeStep <= 0.0)
+	{
+		// Never laid out, there is no offset to preserve.
+		CurrentPageId = NewPage;
+		FunctionSwiped = true;
+		return;
+	}
+
+	const double Shift = (NewPage - CurrentPageId) * PageSwipeStep;
+	CurrentPageId = NewPage;
+	TargetPoint += Shift;
+	StickyswipeAmount += Shift;
+	StickyswipeAmountStart += Shift;
+	MaxValue = FMath::Max(LastChildId, 0) * PageSwipeStep;
+}
+
+double FStickyswipe::GetDistanceFromEnd() const
 {
 	if (LastAllottedGeometry && LastChildId > -1)
 	{
@@ -0,0 +1,182 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Slate/Framework/Layout/SwipePageDrag.h"
+
+#include "Framework/Application/SlateApplication.h"
+#include "Input/Events.h"
+#include "Widgets/SWidget.h"
+
+FSwipePageDrag::FSwipePageDrag(SWidget& InOwner)
+	: Owner(InOwner)
+{
+}
+
+void FSwipePageDrag::SetOffset(const FVector2f& InOffset)
+{
+	if (Offset != InOffset)
+	{
+		Offset = InOffset;
+		Owner.Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void FSwipePageDrag::AnimateTo(const FVector2f& InTargetOffset)
+{
+	AnimationStart = Offset;
+	AnimationTarget = InTargetOffset;
+	AnimationAlpha = 0.f;
+	bAnimating = true;
+}
+
+FIntPoint FSwipePageDrag::FinishPageChange(const FVector2f& InPageSize)
+{
+	if (!bAnimating || AnimationTarget.IsZero())
+	{
+		return FIntPoint::ZeroValue;
+	}
+
+	const FIntPoint Step = GetTargetStep();
+	SetOffset(Offset + FVector2f(Step.X * InPageSize.X, Step.Y * InPageSize.Y));
+	bAnimating = false;
+	return Step;
+}
+
+FIntPoint FSwipePageDrag::TickAnimation(float InDeltaTime)
+{
+	if (!bAnimating)
+	{
+		return FIntPoint::ZeroValue;
+	}
+
+	AnimationAlpha = FMath::Min(AnimationAlpha + InDeltaTime * Speed, 1.f);
+	SetOffset(FVector2f(
+		UKismetMathLibrary::Ease(AnimationStart.X, AnimationTarget.X, AnimationAlpha, Easing, BlendExp),
+		UKismetMathLibrary::Ease(AnimationStart.Y, AnimationTarget.Y, AnimationAlpha, Easing, BlendExp)));
+
+	if (AnimationAlpha < 1.f)
+	{
+		return FIntPoint::ZeroValue;
+	}
+
+	bAnimating = false;
+	if (AnimationTarget.IsZero())
+	{
+		return FIntPoint::ZeroValue;
+	}
+	SetOffset(FVector2f::ZeroVector);
+	return GetTargetStep();
+}
+
+void FSwipePageDrag::OnPreviewTouchStarted(const FPointerEvent& InTouchEvent)
+{
+	if (InTouchEvent.IsTouchEvent() && !FingerOwningTouchInteraction.IsSet())
+	{
+		// Grab the pages where they are, the release decides where they snap.
+		bAnimating = false;
+		PendingSwipeTriggerAmount = FVector2f::ZeroVector;
+		DragAxis.Reset();
+		FingerOwningTouchInteraction = static_cast<int32>(InTouchEvent.GetPointerIndex());
+	}
+}
+
+TOptional<FReply> FSwipePageDrag::OnTouchMoved(const FPointerEvent& InTouchEvent, TOptional<EOrientation> InFixedAxis)
+{
+	// Other fingers neither trigger the drag nor move the pages.
+	if (!InTouchEvent.IsTouchEvent() || !IsOwningFinger(InTouchEvent))
+	{
+		return FReply::Unhandled();
+	}
+
+	if (!DragAxis.IsSet())
+	{
+		PendingSwipeTriggerAmount += InTouchEvent.GetCursorDelta();
+		const float TriggerDistance = FSlateApplication::Get().GetDragTriggerDistance();
+		const bool bTriggeredX = FMath::Abs(PendingSwipeTriggerAmount.X) > TriggerDistance;
+		const bool bTriggeredY = FMath::Abs(PendingSwipeTriggerAmount.Y) > TriggerDistance;
+		const bool bTriggered = InFixedAxis.IsSet()
+			                        ? (InFixedAxis.GetValue() == Orient_Horizontal ? bTriggeredX : bTriggeredY)
+			                        : bTriggeredX || bTriggeredY;
+		if (!bTriggered)
+		{
+			return FReply::Handled();
+		}
+
+		// A gesture that catches a page still moving continues on its axis, otherwise the axis with the most travel
+		// owns the whole gesture.
+		if (InFixedAxis.IsSet())
+		{
+			DragAxis = InFixedAxis.GetValue();
+		}
+		else if (!Offset.IsZero())
+		{
+			DragAxis = Offset.X != 0.f ? Orient_Horizontal : Orient_Vertical;
+		}
+		else
+		{
+			DragAxis = FMath::Abs(PendingSwipeTriggerAmount.X) >= FMath::Abs(PendingSwipeTriggerAmount.Y)
+				           ? Orient_Horizontal
+				           : Orient_Vertical;
+		}
+		return FReply::Handled().CaptureMouse(Owner.AsShared());
+	}
+
+	if (!Owner.HasMouseCaptureByUser(InTouchEvent.GetUserIndex(), InTouchEvent.GetPointerIndex()))
+	{
+		return FReply::Unhandled();
+	}
+	return {};
+}
+
+FReply FSwipePageDrag::OnTouchEnded(const FPointerEvent& InTouchEvent, TFunctionRef<void(EOrientation)> InSnap)
+{
+	if (!IsOwningFinger(InTouchEvent))
+	{
+		return FReply::Unhandled();
+	}
+
+	const TOptional<EOrientation> ReleasedAxis = DragAxis;
+	ResetTouch();
+
+	if (ReleasedAxis.IsSet() && Owner.HasMouseCaptureByUser(InTouchEvent.GetUserIndex(), InTouchEvent.GetPointerIndex()))
+	{
+		InSnap(ReleasedAxis.GetValue());
+		return FReply::Handled().ReleaseMouseCapture();
+	}
+
+	// A tap interrupted an animation, finish it.
+	if (!bAnimating && !Offset.IsZero())
+	{
+		InSnap(Offset.X != 0.f ? Orient_Horizontal : Orient_Vertical);
+	}
+	return FReply::Unhandled();
+}
+
+void FSwipePageDrag::OnMouseCaptureLost(TFunctionRef<void(EOrientation)> InSnap)
+{
+	const TOptional<EOrientation> ReleasedAxis = DragAxis;
+	ResetTouch();
+
+	if (ReleasedAxis.IsSet())
+	{
+		InSnap(ReleasedAxis.GetValue());
+	}
+}
+
+bool FSwipePageDrag::IsOwningFinger(const FPointerEvent& InPointerEvent) const
+{
+	return FingerOwningTouchInteraction.IsSet()
+		&& FingerOwningTouchInteraction.GetValue() == static_cast<int32>(InPointerEvent.GetPointerIndex());
+}
+
+void FSwipePageDrag::ResetTouch()
+{
+	FingerOwningTouchInteraction.Reset();
+	PendingSwipeTriggerAmount = FVector2f::ZeroVector;
+	DragAxis.Reset();
+}
+
+FIntPoint FSwipePageDrag::GetTargetStep() const
+{
+	return FIntPoint(-static_cast<int32>(FMath::Sign(AnimationTarget.X)),
+	                 -static_cast<int32>(FMath::Sign(AnimationTarget.Y)));
+}
@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Slate/Framework/Profiling/SwipeLatencyHistogram.h"
+
+namespace SwipeLatencyHistogramPrivate
+{
+	/** Upper bound of the first bucket, in milliseconds. */
+	constexpr double FirstBucketMs = 0.05;
+
+	/** Number of buckets per doubling of the latency. */
+	constexpr double BucketsPerOctave = 4.0;
+}
+
+FSwipeLatencyHistogram::FSwipeLatencyHistogram()
+{
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+}
+
+void FSwipeLatencyHistogram::AddSample(double InSeconds)
+{
+	Buckets[GetBucketIndex(InSeconds)].fetch_add(1, std::memory_order_relaxed);
+}
+
+double FSwipeLatencyHistogram::GetPercentileMs(float InPercentile) const
+{
+	uint32 Snapshot[NumBuckets];
+	uint64 Total = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		Snapshot[BucketIndex] = Buckets[BucketIndex].load(std::memory_order_relaxed);
+		Total += Snapshot[BucketIndex];
+	}
+
+	if (Total == 0)
+	{
+		return 0.0;
+	}
+
+	const double Rank = FMath::Clamp(InPercentile, 0.f, 100.f) / 100.0 * Total;
+	uint64 CountSoFar = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		if (Snapshot[BucketIndex] == 0)
+		{
+			continue;
+		}
+
+		if (CountSoFar + Snapshot[BucketIndex] >= Rank)
+		{
+			const double LowerMs = GetBucketLowerBoundMs(BucketIndex);
+			const double UpperMs = GetBucketLowerBoundMs(BucketIndex + 1);
+			const double Alpha = (Rank - CountSoFar) / Snapshot[BucketIndex];
+			return FMath::Lerp(LowerMs, UpperMs, FMath::Clamp(Alpha, 0.0, 1.0));
+		}
+		CountSoFar += Snapshot[BucketIndex];
+	}
+
+	return GetBucketLowerBoundMs(NumBuckets);
+}
+
+uint32 FSwipeLatencyHistogram::GetNumSamples() const
+{
+	uint32 Total = 0;
+	for (const std::atomic<uint32>& Bucket : Buckets)
+	{
+		Total += Bucket.load(std::memory_order_relaxed);
+	}
+	return Total;
+}
+
+void FSwipeLatencyHistogram::Reset()
+{
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+}
+
+int32 FSwipeLatencyHistogram::GetBucketIndex(double InSeconds)
+{
+	using namespace SwipeLatencyHistogramPrivate;
+
+	const double Milliseconds = InSeconds * 1000.0;
+	if (Milliseconds < FirstBucketMs)
+	{
+		return 0;
+	}
+
+	const int32 BucketIndex = 1 + FMath::FloorToInt32(FMath::Log2(Milliseconds / FirstBucketMs) * BucketsPerOctave);
+	return FMath::Clamp(BucketIndex, 0, NumBuckets - 1);
+}
+
+double FSwipeLatencyHistogram::GetBucketLowerBoundMs(int32 InBucketIndex)
+{
+	using namespace SwipeLatencyHistogramPrivate;
+
+	if (InBucketIndex <= 0)
+	{
+		return 0.0;
+	}
+	return FirstBucketMs * FMath::Pow(2.0, (InBucketIndex - 1) / BucketsPerOctave);
+}
@@ -5,6 +5,8 @@
 #include "Misc/LazySingleton.h"
 #include "Styling/SlateTypes.h"
 #include "Styling/UMGCoreStyle.h"
+#include "MobileWidgetSwipeStats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #if WITH_EDITOR
 #include "Styling/CoreStyle.h"
@@ -20,22 +22,43 @@ FDefaultStyleCacheExtension& FDefaultStyleCacheExtension::Get()
 
 FDefaultStyleCacheExtension::FDefaultStyleCacheExtension()
 {
-	if (!IsRunningDedicatedServer())
+}
+
+const FDefaultStyleCacheExtension::FStyles& FDefaultStyleCacheExtension::GetRuntime()
+{
+	FStyles& Styles = Get().Runtime;
+	if (!Styles.bInitialized)
 	{
-		Runtime.SwipeBarStyle = FUMGCoreStyle::Get().GetWidgetStyle<FSwipeBarStyle>("SwipeBar");
-		Runtime.SwipeBarStyle.UnlinkColors();
+		Styles.Initialize(FUMGCoreStyle::Get());
+	}
+	return Styles;
+}
 
-		Runtime.SwipeBoxStyle = FUMGCoreStyle::Get().GetWidgetStyle<FSwipeBoxStyle>("SwipeBox");
-		Runtime.SwipeBoxStyle.UnlinkColors();
+#if WITH_EDITOR
+const FDefaultStyleCacheExtension::FStyles& FDefaultStyleCacheExtension::GetEditor()
+{
+	FStyles& Styles = Get().Editor;
+	if (!Styles.bInitialized)
+	{
+		Styles.Initialize(FCoreStyle::Get());
+	}
+	return Styles;
+}
+#endif
 
+void FDefaultStyleCacheExtension::FStyles::Initialize(const ISlateStyle& InStyle)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FDefaultStyleCacheExtension::FStyles::Initialize);
 
-#if WITH_EDITOR
-		Editor.SwipeBarStyle = FCoreStyle::Get().GetWidgetStyle<FSwipeBarStyle>("SwipeBar");
-		Editor.SwipeBarStyle.UnlinkColors();
+	bInitialized = true;
+	if (!IsRunningDedicatedServer())
+	{
+		SwipeBarStyle = InStyle.GetWidgetStyle<FSwipeBarStyle>("SwipeBar");
+		SwipeBarStyle.UnlinkColors();
 
-		Editor.SwipeBoxStyle = FCoreStyle::Get().GetWidgetStyle<FSwipeBoxStyle>("SwipeBox");
-		Editor.SwipeBoxStyle.UnlinkColors();
-#endif
+		SwipeBoxStyle = InStyle.GetWidgetStyle<FSwipeBoxStyle>("SwipeBox");
+		SwipeBoxStyle.UnlinkColors();
 	}
 }
 
@@ -4,10 +4,44 @@
 #include "Rendering/DrawElements.h"
 #include "Types/SlateConstants.h"
 #include "Layout/LayoutUtils.h"
+#include "Math/VectorRegister.h"
 #include "Widgets/SOverlay.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Slate/Widgets/Layout/SSwipeBar.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/Layout/SSpacer.h"
+#include "MobileWidgetSwipeStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Fonts/FontMeasure.h"
+#include "Rendering/SlateRenderer.h"
+#include "Types/PaintArgs.h"
+
+namespace SwipeBoxPrivate
+{
+	/** Tag of the widgets made by SSwipeBox::MakePagePlaceholder. */
+	const FLazyName PagePlaceholderTag(TEXT("SwipeBoxPagePlaceholder"));
+
+	/** Every SSwipeBox alive, used by the debug reports. Only touched from the game thread. */
+	TArray<SSwipeBox*>& GetLiveInstances()
+	{
+		static TArray<SSwipeBox*> LiveInstances;
+		return LiveInstances;
+	}
+
+#if WITH_SLATE_DEBUGGING
+	TAutoConsoleVariable<bool> CVarDebugOverlay(
+		TEXT("SwipeBox.DebugOverlay"),
+		false,
+		TEXT("Draws page boundaries, the sticky swipe target, release velocity, page counts and frame cost over every swipe box."),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*)
+		{
+			SSwipeBox::ForEachLiveInstance([](SSwipeBox& SwipeBox)
+			{
+				SwipeBox.Invalidate(EInvalidateWidgetReason::PaintAndVolatility);
+			});
+		}));
+#endif
+}
 
 
 void SSwipeBox::FSlot::Construct(const FChildren& SlotOwner, FSlotArguments&& InArgs)
@@ -21,6 +55,7 @@ void SSwipeBox::FSlot::Construct(const FChildren& SlotOwner, FSlotArguments&& In
 	{
 		SetSizeParam(MoveTemp(InArgs._SizeParam.GetValue()));
 	}
+	Key = InArgs._Key;
 }
 
 void SSwipeBox::FSlot::RegisterAttributes(FSlateWidgetSlotAttributeInitializer& AttributeInitializer)
@@ -48,6 +83,7 @@ void SSwipePanel::Construct(const FArguments& InArgs, const TArray<SSwipeBox::FS
 	{
 		Children.Add(InSlots[SlotIndex]);
 	}
+	UpdatePageIndex(0);
 	Orientation = InArgs._Orientation;
 	BackPadSwipeing = InArgs._BackPadSwipeing;
 	FrontPadSwipeing = InArgs._FrontPadSwipeing;
@@ -61,6 +97,7 @@ void SSwipePanel::Construct(const FArguments& InArgs, TArray<SSwipeBox::FSlot::F
 {
 	PhysicalOffset = 0;
 	Children.AddSlots(MoveTemp(InSlots));
+	UpdatePageIndex(0);
 	Orientation = InArgs._Orientation;
 	BackPadSwipeing = InArgs._BackPadSwipeing;
 	FrontPadSwipeing = InArgs._FrontPadSwipeing;
@@ -72,27 +109,503 @@ void SSwipePanel::OnArrangeChildren(const FGeometry& AllottedGeometry, FArranged
 	const float SwipePadding = Orientation == Orient_Vertical
 		                           ? AllottedGeometry.GetLocalSize().Y
 		                           : AllottedGeometry.GetLocalSize().X;
-	const float ChildrenOffset = -PhysicalOffset + (BackPadSwipeing ? SwipePadding : 0);
+	const double ChildrenOffset = -PhysicalOffset + (BackPadSwipeing ? SwipePadding : 0);
 	const bool AllowShrink = false;
 
+	if (PendingInputTime > 0.0)
+	{
+		InputLatency.AddSample(FPlatformTime::Seconds() - PendingInputTime);
+		PendingInputTime = 0.0;
+	}
+
+	ArrangedPhysicalOffset = PhysicalOffset;
+	ArrangedViewExtent = SwipePadding;
+	bContentExtentDirty = true;
+	const FInt32Interval* PagesToArrange = ArrangedPages.GetPtrOrNull();
+
 	if (Orientation == EOrientation::Orient_Horizontal)
 	{
 		ArrangeChildrenInStackOverride<EOrientation::Orient_Horizontal>(GSlateFlowDirection, this->Children,
 		                                                                AllottedGeometry, ArrangedChildren,
 		                                                                ChildrenOffset, AllowShrink,
-		                                                                SlotStretchChildAsParentSize);
+		                                                                SlotStretchChildAsParentSize, LayoutInputs,
+		                                                                &PageSpans, PagesToArrange);
 	}
 	else
 	{
 		ArrangeChildrenInStackOverride<EOrientation::Orient_Vertical>(GSlateFlowDirection, this->Children,
 		                                                              AllottedGeometry, ArrangedChildren,
 		                                                              ChildrenOffset, AllowShrink,
-		                                                              SlotStretchChildAsParentSize);
+		                                                              SlotStretchChildAsParentSize, LayoutInputs,
+		                                                              &PageSpans, PagesToArrange);
+	}
+}
+
+SSwipePanel::FStackTotals SSwipePanel::ComputeStackTotals(const FStackLayoutInputs& Inputs, float InAllottedSize,
+                                                          bool InSlotStretchChildAsParentSize)
+{
+	// Compute the sum of stretch coefficients (SizeRule_Stretch) and space required by fixed-size widgets (SizeRule_Auto),
+	// as well as the total desired size.
+	FStackTotals Totals;
+	for (int32 ChildIndex = 0; ChildIndex < Inputs.Num(); ++ChildIndex)
+	{
+		if (!Inputs.IsCollapsed(ChildIndex))
+		{
+			Totals.bAnyChildVisible = true;
+			// All widgets contribute their margin to the fixed space requirement
+			Totals.FixedTotal += Inputs.PaddingsAlong[ChildIndex];
+
+			// Auto-sized children contribute their desired size to the fixed space requirement
+			const float ChildSize = Inputs.SizesAlong[ChildIndex];
+
+			if (Inputs.SizeRules[ChildIndex] == FSizeParam::SizeRule_Stretch)
+			{
+				// for stretch children we save sum up the stretch coefficients, a page stretched as its parent
+				// takes the whole allotted size
+				Totals.StretchCoefficientTotal += Inputs.SizeValues[ChildIndex];
+				Totals.StretchSizeTotal += InSlotStretchChildAsParentSize ? InAllottedSize : ChildSize;
+			}
+			else
+			{
+				// Clamp to the max size if it was specified
+				const float MaxSize = Inputs.MaxSizes[ChildIndex];
+				Totals.FixedTotal += MaxSize > 0.0f ? FMath::Min(MaxSize, ChildSize) : ChildSize;
+			}
+		}
+	}
+	return Totals;
+}
+
+double SSwipePanel::ComputeChildSpans(FStackLayoutInputs& Inputs, float InNonFixedSpace,
+                                      float InStretchCoefficientTotal, bool InSlotStretchChildAsParentSize,
+                                      bool bInReverse, bool bInVectorized)
+{
+	const int32 NumChildren = Inputs.Num();
+	Inputs.Extents.SetNumUninitialized(NumChildren, false);
+	Inputs.Starts.SetNumUninitialized(NumChildren, false);
+	float* Extents = Inputs.Extents.GetData();
+	double* Starts = Inputs.Starts.GetData();
+
+	const int32 NumVectorized = bInVectorized ? NumChildren & ~3 : 0;
+	const VectorRegister4Float Zero = VectorZeroFloat();
+
+	if (NumVectorized > 0)
+	{
+		// Stretch children take space * coefficient / total like ComputeChildSizeAlong, so both paths agree. Without
+		// coefficients they get 0 * coefficient / 1.
+		const bool bCanStretch = InStretchCoefficientTotal > 0.0f;
+		const VectorRegister4Float NonFixedSpace = VectorSetFloat1(bCanStretch ? InNonFixedSpace : 0.0f);
+		const VectorRegister4Float StretchCoefficientTotal = VectorSetFloat1(bCanStretch ? InStretchCoefficientTotal : 1.0f);
+		const VectorRegister4Float PaddingScale = VectorSetFloat1(InSlotStretchChildAsParentSize ? 0.0f : 1.0f);
+
+		for (int32 ChildIndex = 0; ChildIndex < NumVectorized; ChildIndex += 4)
+		{
+			const VectorRegister4Float StretchSize = VectorDivide(
+				VectorMultiply(NonFixedSpace, VectorLoad(&Inputs.SizeValues[ChildIndex])), StretchCoefficientTotal);
+			const VectorRegister4Float IsStretch = VectorCompareGT(VectorLoad(&Inputs.StretchFlags[ChildIndex]), Zero);
+			VectorRegister4Float Size = VectorSelect(IsStretch, StretchSize, VectorLoad(&Inputs.SizesAlong[ChildIndex]));
+
+			const VectorRegister4Float MaxSize = VectorLoad(&Inputs.MaxSizes[ChildIndex]);
+			Size = VectorSelect(VectorCompareGT(MaxSize, Zero), VectorMin(MaxSize, Size), Size);
+
+			const VectorRegister4Float Extent = VectorMultiplyAdd(VectorLoad(&Inputs.PaddingsAlong[ChildIndex]),
+			                                                      PaddingScale, Size);
+			const VectorRegister4Float IsVisible = VectorCompareGT(VectorLoad(&Inputs.VisibleFlags[ChildIndex]), Zero);
+			VectorStore(VectorSelect(IsVisible, Extent, Zero), &Extents[ChildIndex]);
+		}
+	}
+	for (int32 ChildIndex = NumVectorized; ChildIndex < NumChildren; ++ChildIndex)
+	{
+		Extents[ChildIndex] = Inputs.IsCollapsed(ChildIndex)
+			                      ? 0.0f
+			                      : ComputeChildSizeAlong(Inputs, ChildIndex, InNonFixedSpace, InStretchCoefficientTotal)
+			                      + (InSlotStretchChildAsParentSize ? 0.0f : Inputs.PaddingsAlong[ChildIndex]);
+	}
+
+	double Total = 0.0;
+	if (NumVectorized > 0)
+	{
+		// Lane 0 is dropped when shifting the extents up by one lane.
+		const VectorRegister4Float UpperLanes = VectorCompareGT(MakeVectorRegisterFloat(0.f, 1.f, 1.f, 1.f), Zero);
+
+		for (int32 ChildIndex = 0; ChildIndex < NumVectorized; ChildIndex += 4)
+		{
+			// Inclusive prefix sum of four extents: adding the extents shifted by one lane, then the partial sums
+			// shifted by two lanes.
+			const VectorRegister4Float Extent = VectorLoad(&Extents[ChildIndex]);
+			VectorRegister4Float Inclusive = VectorAdd(Extent, VectorSelect(UpperLanes, VectorSwizzle(Extent, 0, 0, 1, 2), Zero));
+			Inclusive = VectorAdd(Inclusive, VectorShuffle(Zero, Inclusive, 0, 0, 0, 1));
+
+			alignas(16) float Sums[4];
+			VectorStoreAligned(Inclusive, Sums);
+			Starts[ChildIndex] = Total;
+			Starts[ChildIndex + 1] = Total + Sums[0];
+			Starts[ChildIndex + 2] = Total + Sums[1];
+			Starts[ChildIndex + 3] = Total + Sums[2];
+			Total += Sums[3];
+		}
+	}
+	for (int32 ChildIndex = NumVectorized; ChildIndex < NumChildren; ++ChildIndex)
+	{
+		Starts[ChildIndex] = Total;
+		Total += Extents[ChildIndex];
+	}
+
+	if (bInReverse)
+	{
+		// Laid out from the last child, a slot starts where the children after it end.
+		for (int32 ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+		{
+			Starts[ChildIndex] = Total - Starts[ChildIndex] - Extents[ChildIndex];
+		}
+	}
+	return Total;
+}
+
+double SSwipePanel::ComputeStackExtent(FStackLayoutInputs& Inputs, float InAllottedSize, bool InAllowShrink,
+                                       bool InSlotStretchChildAsParentSize)
+{
+	const FStackTotals Totals = ComputeStackTotals(Inputs, InAllottedSize, InSlotStretchChildAsParentSize);
+	if (!Totals.bAnyChildVisible)
+	{
+		return 0.0;
+	}
+
+	const float NonFixedSpace = ComputeNonFixedSpace(Totals, InAllottedSize, InAllowShrink);
+	return ComputeChildSpans(Inputs, NonFixedSpace, Totals.StretchCoefficientTotal, InSlotStretchChildAsParentSize,
+	                         false, Inputs.Num() >= MinChildrenToVectorizeSpans);
+}
+
+FInt32Interval SSwipePanel::GetPagesInView(double InPhysicalOffset) const
+{
+	FInt32Interval PagesInView;
+	if (PageSpans.Num() != Children.Num() || ArrangedViewExtent <= 0.f)
+	{
+		return PagesInView;
+	}
+
+	const double ChildrenOffset = GetChildrenOffset(InPhysicalOffset);
+	const double ViewStart = -ChildrenOffset;
+	const double ViewEnd = ArrangedViewExtent - ChildrenOffset;
+
+	// The spans follow the page order, or the reverse order when the pages flow right to left, so the pages in
+	// view are found by binary search over the positions along the orientation.
+	const int32 NumPages = PageSpans.Num();
+	const bool bReversed = NumPages > 1 && PageSpans[0].X > PageSpans.Last().X;
+	auto SpanAt = [this, NumPages, bReversed](int32 Position) -> const FVector2d&
+	{
+		return PageSpans[bReversed ? NumPages - 1 - Position : Position];
+	};
+	auto FirstPositionWhere = [NumPages](auto&& Predicate)
+	{
+		int32 Low = 0;
+		int32 High = NumPages;
+		while (Low < High)
+		{
+			const int32 Mid = Low + (High - Low) / 2;
+			if (Predicate(Mid))
+			{
+				High = Mid;
+			}
+			else
+			{
+				Low = Mid + 1;
+			}
+		}
+		return Low;
+	};
+	int32 Begin = FirstPositionWhere([&SpanAt, ViewStart](int32 Position) { return SpanAt(Position).Y > ViewStart; });
+	int32 End = FirstPositionWhere([&SpanAt, ViewEnd](int32 Position) { return SpanAt(Position).X >= ViewEnd; });
+
+	// Collapsed pages take no space and only count between two pages in view.
+	while (Begin < End && SpanAt(Begin).Y <= SpanAt(Begin).X)
+	{
+		++Begin;
+	}
+	while (End > Begin && SpanAt(End - 1).Y <= SpanAt(End - 1).X)
+	{
+		--End;
+	}
+
+	if (Begin < End)
+	{
+		PagesInView = bReversed
+			              ? FInt32Interval(NumPages - End, NumPages - 1 - Begin)
+			              : FInt32Interval(Begin, End - 1);
+	}
+	return PagesInView;
+}
+
+int32 SSwipePanel::FindPageIndex(const SWidget& InDescendant) const
+{
+	EnsurePageIndex();
+
+	const SWidget* Widget = &InDescendant;
+	bool bRebuilt = false;
+	while (Widget != nullptr && Widget != this)
+	{
+		const int32* PageIndex = PageIndexByWidget.Find(Widget);
+		const bool bIsPage = Widget->GetParentWidget().Get() == this;
+		const bool bValidHit = PageIndex && Children.IsValidIndex(*PageIndex) && &Children[*PageIndex].GetWidget().Get() == Widget;
+		if (!bValidHit && (PageIndex || bIsPage) && !bRebuilt)
+		{
+			// A stale entry, or a page content attached to its slot directly, which Slate allows. The pointer may
+			// belong to a widget allocated where a removed page used to be, so the whole index is rebuilt.
+			UE_LOG(LogSlate, Verbose, TEXT("SSwipePanel page index is out of date, rebuilding it."));
+			RebuildPageIndex();
+			bRebuilt = true;
+			continue;
+		}
+		if (bValidHit)
+		{
+			return *PageIndex;
+		}
+		// The parent is kept alive by its own parent, the raw pointer outlives the temporary shared pointer.
+		Widget = Widget->GetParentWidget().Get();
+	}
+	return INDEX_NONE;
+}
+
+void SSwipePanel::UpdatePageIndex(int32 InFirstIndex)
+{
+	// The page extents and the arranged range refer to the old indices until the next arrange pass.
+	PageSpans.Reset();
+	ArrangedPages.Reset();
+	bContentExtentDirty = true;
+
+	// Reindexing is deferred to the next lookup, so inserting many slots in front of the others stays linear.
+	FirstUnindexedPage = FMath::Min(FirstUnindexedPage, FMath::Max(InFirstIndex, 0));
+}
+
+void SSwipePanel::EnsurePageIndex() const
+{
+	for (int32 SlotIndex = FirstUnindexedPage; SlotIndex < Children.Num(); ++SlotIndex)
+	{
+		const TSharedRef<SWidget>& Widget = Children[SlotIndex].GetWidget();
+		if (Widget != SNullWidget::NullWidget)
+		{
+			PageIndexByWidget.Add(&Widget.Get(), SlotIndex);
+		}
+
+		const FName Key = Children[SlotIndex].GetKey();
+		if (!Key.IsNone())
+		{
+			PageIndexByKey.Add(Key, SlotIndex);
+		}
+	}
+	FirstUnindexedPage = MAX_int32;
+}
+
+void SSwipePanel::RebuildPageIndex() const
+{
+	PageIndexByWidget.Reset();
+	PageIndexByKey.Reset();
+	FirstUnindexedPage = 0;
+	EnsurePageIndex();
+}
+
+void SSwipePanel::AddPage(SSwipeBox::FSlot::FSlotArguments&& InSlotArguments)
+{
+	Children.AddSlot(MoveTemp(InSlotArguments));
+	UpdatePageIndex(Children.Num() - 1);
+}
+
+void SSwipePanel::AddPages(TArray<SSwipeBox::FSlot::FSlotArguments> InSlots)
+{
+	const int32 FirstNewIndex = Children.Num();
+	Children.AddSlots(MoveTemp(InSlots));
+	UpdatePageIndex(FirstNewIndex);
+}
+
+int32 SSwipePanel::RemovePages(TConstArrayView<TSharedRef<SWidget>> InWidgets)
+{
+	EnsurePageIndex();
+
+	TArray<int32, TInlineAllocator<16>> SlotIndices;
+	SlotIndices.Reserve(InWidgets.Num());
+	for (const TSharedRef<SWidget>& Widget : InWidgets)
+	{
+		const int32* SlotIndex = PageIndexByWidget.Find(&Widget.Get());
+		const bool bValidHit = SlotIndex && Children.IsValidIndex(*SlotIndex) && Children[*SlotIndex].GetWidget() == Widget;
+		if (!bValidHit && (SlotIndex || Widget->GetParentWidget().Get() == this))
+		{
+			// Same as FindPageIndex, a page content may have been attached to its slot directly.
+			UE_LOG(LogSlate, Verbose, TEXT("SSwipePanel page index is out of date, rebuilding it."));
+			RebuildPageIndex();
+			SlotIndex = PageIndexByWidget.Find(&Widget.Get());
+		}
+		if (SlotIndex)
+		{
+			SlotIndices.AddUnique(*SlotIndex);
+		}
+	}
+
+	// Remove from the back so the indices of the slots still to remove stay valid.
+	SlotIndices.Sort(TGreater<int32>());
+	for (const int32 SlotIndex : SlotIndices)
+	{
+		PageIndexByWidget.Remove(&Children[SlotIndex].GetWidget().Get());
+		PageIndexByKey.Remove(Children[SlotIndex].GetKey());
+		Children.RemoveAt(SlotIndex);
+	}
+
+	if (SlotIndices.Num() > 0)
+	{
+		UpdatePageIndex(SlotIndices.Last());
+	}
+	return SlotIndices.Num();
+}
+
+int32 SSwipePanel::RemovePage(const TSharedRef<SWidget>& InWidget)
+{
+	for (int32 SlotIndex = 0; SlotIndex < Children.Num(); ++SlotIndex)
+	{
+		if (Children[SlotIndex].GetWidget() == InWidget)
+		{
+			PageIndexByWidget.Remove(&InWidget.Get());
+			PageIndexByKey.Remove(Children[SlotIndex].GetKey());
+			Children.RemoveAt(SlotIndex);
+			UpdatePageIndex(SlotIndex);
+			return SlotIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void SSwipePanel::ClearPages()
+{
+	Children.Empty();
+	PageIndexByWidget.Reset();
+	PageIndexByKey.Reset();
+	FirstUnindexedPage = MAX_int32;
+	bContentExtentDirty = true;
+	PageSpans.Reset();
+	ArrangedPages.Reset();
+}
+
+bool SSwipePanel::SyncPages(TConstArrayView<FName> InKeys,
+                            TFunctionRef<SSwipeBox::FSlot::FSlotArguments(FName, int32)> InMakePage)
+{
+	// Position of every wanted key, built once so neither the removal nor the reorder has to scan the panel.
+	SyncKeyOrder.Reset();
+	SyncKeyOrder.Reserve(InKeys.Num());
+	for (int32 KeyIndex = 0; KeyIndex < InKeys.Num(); ++KeyIndex)
+	{
+		SyncKeyOrder.FindOrAdd(InKeys[KeyIndex], KeyIndex);
+	}
+	if (SyncKeyOrder.Num() != InKeys.Num() || SyncKeyOrder.Contains(NAME_None))
+	{
+		UE_LOG(LogSlate, Warning, TEXT("SSwipeBox::SyncSlots expects unique keys that are not None, the slots are left as they are."));
+		return false;
+	}
+
+	int32 FirstChangedIndex = Children.Num();
+	auto RemovePageAt = [this, &FirstChangedIndex](int32 SlotIndex)
+	{
+		PageIndexByWidget.Remove(&Children[SlotIndex].GetWidget().Get());
+		PageIndexByKey.Remove(Children[SlotIndex].GetKey());
+		Children.RemoveAt(SlotIndex);
+		FirstChangedIndex = FMath::Min(FirstChangedIndex, SlotIndex);
+	};
+
+	// Drop the pages that are not wanted anymore. Pages without a key cannot be matched against InKeys and are
+	// dropped as well, so are the duplicates of a key, the first page holding it is kept.
+	int32 NumUnkeyedPages = 0;
+	SyncKeptPages.Reset();
+	for (int32 SlotIndex = 0; SlotIndex < Children.Num();)
+	{
+		const FName Key = Children[SlotIndex].GetKey();
+		if (Key.IsNone())
+		{
+			++NumUnkeyedPages;
+		}
+		else if (SyncKeyOrder.Contains(Key))
+		{
+			if (const int32* KeptIndex = SyncKeptPages.Find(Key))
+			{
+				// Removing the duplicate drops the entry of the key, the kept page is indexed again.
+				FirstChangedIndex = FMath::Min(FirstChangedIndex, *KeptIndex);
+			}
+			else
+			{
+				SyncKeptPages.Add(Key, SlotIndex);
+				++SlotIndex;
+				continue;
+			}
+		}
+		RemovePageAt(SlotIndex);
+	}
+	UE_CLOG(NumUnkeyedPages > 0, LogSlate, Warning,
+	        TEXT("SSwipeBox::SyncSlots removed %d slot(s) without a key, give every slot a key before syncing."),
+	        NumUnkeyedPages);
+
+	// The kept pages are all wanted now and hold distinct keys, append the missing ones and then move every page to
+	// the position of its key.
+	for (int32 KeyIndex = 0; KeyIndex < InKeys.Num(); ++KeyIndex)
+	{
+		const FName Key = InKeys[KeyIndex];
+		if (!SyncKeptPages.Contains(Key))
+		{
+			Children.AddSlot(InMakePage(Key, KeyIndex));
+			Children[Children.Num() - 1].Key = Key;
+		}
+	}
+
+	// The pages in front of the first misplaced one hold the smallest positions, the stable sort leaves them in place.
+	const int32 NumOrderedPages = FMath::Min(Children.Num(), InKeys.Num());
+	int32 FirstMisplacedIndex = 0;
+	while (FirstMisplacedIndex < NumOrderedPages && Children[FirstMisplacedIndex].GetKey() == InKeys[FirstMisplacedIndex])
+	{
+		++FirstMisplacedIndex;
+	}
+	if (FirstMisplacedIndex < Children.Num())
+	{
+		FirstChangedIndex = FMath::Min(FirstChangedIndex, FirstMisplacedIndex);
+		Children.StableSort([this](const SSwipeBox::FSlot& A, const SSwipeBox::FSlot& B)
+		{
+			return SyncKeyOrder.FindChecked(A.GetKey()) < SyncKeyOrder.FindChecked(B.GetKey());
+		});
+	}
+
+	UpdatePageIndex(FirstChangedIndex);
+	return true;
+}
+
+int32 SSwipePanel::FindPageIndexByKey(FName InKey) const
+{
+	EnsurePageIndex();
+	const int32* PageIndex = PageIndexByKey.Find(InKey);
+	if (PageIndex && Children.IsValidIndex(*PageIndex) && Children[*PageIndex].GetKey() == InKey)
+	{
+		return *PageIndex;
+	}
+	return INDEX_NONE;
+}
+
+void SSwipePanel::SetPageContent(int32 InPageIndex, const TSharedRef<SWidget>& InContent)
+{
+	if (!Children.IsValidIndex(InPageIndex))
+	{
+		return;
+	}
+
+	SSwipeBox::FSlot& PageSlot = Children[InPageIndex];
+	PageIndexByWidget.Remove(&PageSlot.GetWidget().Get());
+	PageSlot.AttachWidget(InContent);
+	bContentExtentDirty = true;
+	// Pages from FirstUnindexedPage onward are indexed by the next lookup.
+	if (InContent != SNullWidget::NullWidget && InPageIndex < FirstUnindexedPage)
+	{
+		PageIndexByWidget.Add(&InContent.Get(), InPageIndex);
 	}
 }
 
 FVector2D SSwipePanel::ComputeDesiredSize(float) const
 {
+	// Pages stretched as the view and the swipe padding scale with the allotted size, which is only known when
+	// arranging. They are left out here so the desired size never depends on the geometry of a previous frame,
+	// see GetContentExtent.
+	bContentExtentDirty = true;
 	FVector2D ThisDesiredSize = FVector2D::ZeroVector;
 	for (int32 SlotIndex = 0; SlotIndex < Children.Num(); ++SlotIndex)
 	{
@@ -108,8 +621,8 @@ FVector2D SSwipePanel::ComputeDesiredSize(float) const
 
 				if (SlotStretchChildAsParentSize)
 				{
-					FGeometry PaintSpaceGeometry = GetPaintSpaceGeometry();
-					ThisDesiredSize.Y += PaintSpaceGeometry.GetLocalSize().Y;
+					// A page fills the view, the view wants to fit the largest one.
+					ThisDesiredSize.Y = FMath::Max(ChildDesiredSize.Y, ThisDesiredSize.Y);
 				}
 				else
 				{
@@ -121,9 +634,7 @@ FVector2D SSwipePanel::ComputeDesiredSize(float) const
 			{
 				if (SlotStretchChildAsParentSize)
 				{
-					FGeometry PaintSpaceGeometry = GetPaintSpaceGeometry();
-
-					ThisDesiredSize.X += PaintSpaceGeometry.GetLocalSize().X;
+					ThisDesiredSize.X = FMath::Max(ChildDesiredSize.X, ThisDesiredSize.X);
 				}
 				else
 				{
@@ -136,17 +647,47 @@ FVector2D SSwipePanel::ComputeDesiredSize(float) const
 			}
 		}
 	}
-
-	FVector2D::FReal SwipePadding = Orientation == Orient_Vertical
-		                                ? GetTickSpaceGeometry().GetLocalSize().Y
-		                                : GetTickSpaceGeometry().GetLocalSize().X;
-	FVector2D::FReal& SizeSideToPad = Orientation == Orient_Vertical ? ThisDesiredSize.Y : ThisDesiredSize.X;
-	SizeSideToPad += BackPadSwipeing ? SwipePadding : 0;
-	SizeSideToPad += FrontPadSwipeing ? SwipePadding : 0;
-	// UE_LOG(LogTemp, Warning, TEXT("ComputeDesiredSize: x: %f, y: %f"), ThisDesiredSize.X, ThisDesiredSize.Y)
 	return ThisDesiredSize;
 }
 
+int32 SSwipePanel::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+                           FSlateWindowElementList& OutDrawElements, int32 LayerId,
+                           const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	// Children inherit the hit testability of the paint args, clearing it keeps the whole page subtree out of the
+	// hit test grid while leaving every widget visibility untouched.
+	const FPaintArgs PageArgs = bPagesHitTestInvisible ? Args.WithNewHitTestability(false) : Args;
+	return SPanel::OnPaint(PageArgs, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle,
+	                       bParentEnabled);
+}
+
+double SSwipePanel::GetContentExtent(float InViewExtent) const
+{
+	// Asked several times per tick and on every swipe move, while the pages only change between layout passes.
+	if (!bContentExtentDirty && CachedContentViewExtent == InViewExtent)
+	{
+		return CachedContentExtent;
+	}
+
+	const bool AllowShrink = false;
+	if (Orientation == Orient_Vertical)
+	{
+		LayoutInputs.Gather<Orient_Vertical>(Children, GSlateFlowDirection);
+	}
+	else
+	{
+		LayoutInputs.Gather<Orient_Horizontal>(Children, GSlateFlowDirection);
+	}
+	double ContentExtent = ComputeStackExtent(LayoutInputs, InViewExtent, AllowShrink, SlotStretchChildAsParentSize);
+	ContentExtent += BackPadSwipeing ? InViewExtent : 0.f;
+	ContentExtent += FrontPadSwipeing ? InViewExtent : 0.f;
+
+	CachedContentExtent = ContentExtent;
+	CachedContentViewExtent = InViewExtent;
+	bContentExtentDirty = false;
+	return ContentExtent;
+}
+
 SSwipeBox::SSwipeBox()
 	: DesiredSwipeOffset(0),
 	  TickSwipeDelta(0),
@@ -165,6 +706,7 @@ SSwipeBox::SSwipeBox()
 	  SwipeBarStyle(nullptr),
 	  ConsumeMouseWheel(),
 	  LastSwipeTime(0),
+	  PendingInputTime(0),
 	  bAnimateWheelSwipeing(false),
 	  bShowSoftwareCursor(false),
 	  bSwipeBarIsExternal(false),
@@ -173,14 +715,34 @@ SSwipeBox::SSwipeBox()
 	  bSwipeToEnd(false),
 	  bIsSwipeingActiveTimerRegistered(false),
 	  bAllowsRightClickDragSwipeing(false),
-	  bTouchPanningCapture(false)
+	  bTouchPanningCapture(false),
+	  bAssumeTouchCaptureForTesting(false),
+	  PanelPathArrangedChildren(EVisibility::All)
 {
 	VerticalSwipeBarSlot = nullptr;
 	bClippingProxy = true;
+
+	check(IsInGameThread());
+	SwipeBoxPrivate::GetLiveInstances().Add(this);
+}
+
+SSwipeBox::~SSwipeBox()
+{
+	check(IsInGameThread());
+	SwipeBoxPrivate::GetLiveInstances().RemoveSwap(this);
+}
+
+void SSwipeBox::ForEachLiveInstance(TFunctionRef<void(SSwipeBox&)> InFunction)
+{
+	for (SSwipeBox* SwipeBox : SwipeBoxPrivate::GetLiveInstances())
+	{
+		InFunction(*SwipeBox);
+	}
 }
 
 void SSwipeBox::Construct(const FArguments& InArgs)
 {
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
 	check(InArgs._Style);
 
 	Style = InArgs._Style;
@@ -193,6 +755,11 @@ void SSwipeBox::Construct(const FArguments& InArgs)
 	bShowSoftwareCursor = false;
 	SoftwareCursorPosition = FVector2f::ZeroVector;
 	OnUserSwipeed = InArgs._OnUserSwipeed;
+	OnPageWillAppear = InArgs._OnPageWillAppear;
+	OnPageDidAppear = InArgs._OnPageDidAppear;
+	OnPageDidDisappear = InArgs._OnPageDidDisappear;
+	bSuspendOffscreenPages = InArgs._SuspendOffscreenPages;
+	bSuspendPageHitTestWhileSwiping = InArgs._SuspendPageHitTestWhileSwiping;
 	Orientation = InArgs._Orientation;
 	bSwipeToEnd = false;
 	bIsSwipeingActiveTimerRegistered = false;
@@ -388,18 +955,137 @@ void SSwipeBox::ConstructHorizontalLayout()
 /** Adds a slot to SSwipeBox */
 SSwipeBox::FScopedWidgetSlotArguments SSwipeBox::AddSlot()
 {
-	return FScopedWidgetSlotArguments{MakeUnique<FSlot>(), SwipePanel->Children, INDEX_NONE};
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	return FScopedWidgetSlotArguments{MakeUnique<FSlot>(), SwipePanel->Children, INDEX_NONE,
+		[this](const FSlot*, int32 InSlotIndex)
+		{
+			SwipePanel->UpdatePageIndex(InSlotIndex);
+			InvalidateKeyboardFocusCache();
+		}};
+}
+
+void SSwipeBox::AddSlot(FSlot::FSlotArguments&& InSlotArguments)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	SwipePanel->AddPage(MoveTemp(InSlotArguments));
+	InvalidateKeyboardFocusCache();
+}
+
+void SSwipeBox::AddSlots(TArray<FSlot::FSlotArguments> InSlots)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	if (InSlots.Num() > 0)
+	{
+		SwipePanel->AddPages(MoveTemp(InSlots));
+		InvalidateKeyboardFocusCache();
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
 }
 
 /** Removes a slot at the specified location */
 void SSwipeBox::RemoveSlot(const TSharedRef<SWidget>& WidgetToRemove)
 {
-	SwipePanel->Children.Remove(WidgetToRemove);
+	if (SwipePanel->RemovePage(WidgetToRemove) != INDEX_NONE)
+	{
+		InvalidateKeyboardFocusCache();
+	}
+}
+
+int32 SSwipeBox::RemoveSlots(TConstArrayView<TSharedRef<SWidget>> WidgetsToRemove)
+{
+	const int32 NumRemoved = SwipePanel->RemovePages(WidgetsToRemove);
+	if (NumRemoved > 0)
+	{
+		InvalidateKeyboardFocusCache();
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+	return NumRemoved;
+}
+
+void SSwipeBox::SyncSlots(TConstArrayView<FName> InKeys,
+                          TFunctionRef<FSlot::FSlotArguments(FName InKey, int32 InSlotIndex)> InMakeSlot)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+
+	const int32 PreviousPage = StickySwipe.GetCurrentPage();
+	const FName AnchorKey = SwipePanel->Children.IsValidIndex(PreviousPage)
+		                        ? SwipePanel->Children[PreviousPage].GetKey()
+		                        : NAME_None;
+
+	if (!SwipePanel->SyncPages(InKeys, InMakeSlot))
+	{
+		return;
+	}
+	InvalidateKeyboardFocusCache();
+	Invalidate(EInvalidateWidgetReason::Layout);
+
+	// Keep showing the same page, when it was removed stay at the same index.
+	const int32 AnchorPage = AnchorKey.IsNone() ? INDEX_NONE : SwipePanel->FindPageIndexByKey(AnchorKey);
+	StickySwipe.RebaseCurrentPage(AnchorPage != INDEX_NONE ? AnchorPage : PreviousPage, SwipePanel->Children.Num());
+}
+
+int32 SSwipeBox::FindSlotIndexByKey(FName InKey) const
+{
+	return InKey.IsNone() ? INDEX_NONE : SwipePanel->FindPageIndexByKey(InKey);
+}
+
+bool SSwipeBox::ReplaceSlotContent(const SWidget& InOldContent, const TSharedRef<SWidget>& InNewContent)
+{
+	const int32 SlotIndex = SwipePanel->FindPageIndex(InOldContent);
+	if (SlotIndex == INDEX_NONE || &SwipePanel->Children[SlotIndex].GetWidget().Get() != &InOldContent)
+	{
+		return false;
+	}
+
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	SwipePanel->SetPageContent(SlotIndex, InNewContent);
+	InvalidateKeyboardFocusCache();
+	return true;
+}
+
+void SSwipeBox::ReplaceSlots(TArray<FSlot::FSlotArguments> InSlots)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	SwipePanel->ClearPages();
+	SwipePanel->AddPages(MoveTemp(InSlots));
+	InvalidateKeyboardFocusCache();
+	Invalidate(EInvalidateWidgetReason::Layout);
 }
 
 void SSwipeBox::ClearChildren()
 {
-	SwipePanel->Children.Empty();
+	SwipePanel->ClearPages();
+	InvalidateKeyboardFocusCache();
+}
+
+int32 SSwipeBox::GetNumSlots() const
+{
+	return SwipePanel->Children.Num();
+}
+
+int32 SSwipeBox::GetNumRealizedPages() const
+{
+	int32 NumRealized = 0;
+	for (int32 SlotIndex = 0; SlotIndex < SwipePanel->Children.Num(); ++SlotIndex)
+	{
+		const TSharedRef<SWidget>& Page = SwipePanel->Children[SlotIndex].GetWidget();
+		if (Page != SNullWidget::NullWidget && !IsPagePlaceholder(*Page))
+		{
+			++NumRealized;
+		}
+	}
+	return NumRealized;
+}
+
+TSharedRef<SWidget> SSwipeBox::MakePagePlaceholder()
+{
+	// Each page needs its own placeholder, the slot is found by its widget when the page is removed.
+	return SNew(SSpacer).Tag(SwipeBoxPrivate::PagePlaceholderTag.Resolve());
+}
+
+bool SSwipeBox::IsPagePlaceholder(const SWidget& InWidget)
+{
+	return InWidget.GetTag() == SwipeBoxPrivate::PagePlaceholderTag.Resolve();
 }
 
 bool SSwipeBox::IsRightClickSwipeing() const
@@ -413,29 +1099,93 @@ float SSwipeBox::GetSwipeOffset() const
 	return DesiredSwipeOffset;
 }
 
+FGeometry SSwipeBox::GetSwipePanelGeometry(const FGeometry& InMyGeometry) const
+{
+	FGeometry Geometry;
+	if (!FindDescendantGeometry(InMyGeometry, *SwipePanel, Geometry))
+	{
+		return FindChildGeometry(InMyGeometry, SwipePanel.ToSharedRef());
+	}
+	return Geometry;
+}
+
+bool SSwipeBox::FindDescendantGeometry(const FGeometry& InMyGeometry, const SWidget& InDescendant,
+                                       FGeometry& OutGeometry) const
+{
+	// Same result as FindChildGeometry without its set and map: arranges only the widgets between the box and the
+	// descendant, into a buffer that keeps its capacity from one call to the next.
+	TArray<const SWidget*, TInlineAllocator<16>> PathToDescendant;
+	for (const SWidget* Widget = &InDescendant; Widget != this; Widget = Widget->GetParentWidget().Get())
+	{
+		if (!Widget)
+		{
+			return false;
+		}
+		PathToDescendant.Add(Widget);
+	}
+
+	FGeometry Geometry = InMyGeometry;
+	const SWidget* Parent = this;
+	for (int32 PathIndex = PathToDescendant.Num() - 1; PathIndex >= 0; --PathIndex)
+	{
+		PanelPathArrangedChildren.GetInternalArray().Reset();
+		Parent->ArrangeChildren(Geometry, PanelPathArrangedChildren);
+
+		const int32 ChildIndex = PanelPathArrangedChildren.GetInternalArray().IndexOfByPredicate(
+			[Child = PathToDescendant[PathIndex]](const FArrangedWidget& Arranged) { return &Arranged.Widget.Get() == Child; });
+		if (ChildIndex == INDEX_NONE)
+		{
+			PanelPathArrangedChildren.GetInternalArray().Reset();
+			return false;
+		}
+		Geometry = PanelPathArrangedChildren[ChildIndex].Geometry;
+		Parent = PathToDescendant[PathIndex];
+	}
+
+	// Do not keep the arranged widgets alive until the next call.
+	PanelPathArrangedChildren.GetInternalArray().Reset();
+	OutGeometry = Geometry;
+	return true;
+}
+
+double SSwipeBox::GetContentSize(const FGeometry& InSwipePanelGeometry) const
+{
+	return SwipePanel->GetContentExtent(GetSwipeComponentFromVector(InSwipePanelGeometry.GetLocalSize()));
+}
+
 float SSwipeBox::GetSwipeOffsetOfEnd() const
 {
-	const FGeometry SwipePanelGeometry = FindChildGeometry(CachedGeometry, SwipePanel.ToSharedRef());
-	const float ContentSize = GetSwipeComponentFromVector(SwipePanel->GetDesiredSize());
-	return FMath::Max(ContentSize - GetSwipeComponentFromVector(SwipePanelGeometry.Size), 0.0f);
+	const FGeometry SwipePanelGeometry = GetSwipePanelGeometry(CachedGeometry);
+	const double ContentSize = GetContentSize(SwipePanelGeometry);
+	return static_cast<float>(FMath::Max(ContentSize - GetSwipeComponentFromVector(SwipePanelGeometry.Size), 0.0));
 }
 
 float SSwipeBox::GetViewFraction() const
 {
-	const FGeometry SwipePanelGeometry = FindChildGeometry(CachedGeometry, SwipePanel.ToSharedRef());
-	const float ContentSize = GetSwipeComponentFromVector(SwipePanel->GetDesiredSize());
+	const FGeometry SwipePanelGeometry = GetSwipePanelGeometry(CachedGeometry);
+	return GetViewFraction(SwipePanelGeometry, GetContentSize(SwipePanelGeometry));
+}
+
+float SSwipeBox::GetViewFraction(const FGeometry& InSwipePanelGeometry, double InContentSize) const
+{
+	const float ContentSize = static_cast<float>(InContentSize);
 
 	return FMath::Clamp<float>(GetSwipeComponentFromVector(CachedGeometry.GetLocalSize()) > 0
-		                           ? GetSwipeComponentFromVector(SwipePanelGeometry.Size) / ContentSize
+		                           ? GetSwipeComponentFromVector(InSwipePanelGeometry.Size) / ContentSize
 		                           : 1, 0.0f, 1.0f);
 }
 
 float SSwipeBox::GetViewOffsetFraction() const
 {
-	const FGeometry SwipePanelGeometry = FindChildGeometry(CachedGeometry, SwipePanel.ToSharedRef());
-	const float ContentSize = GetSwipeComponentFromVector(SwipePanel->GetDesiredSize());
+	const FGeometry SwipePanelGeometry = GetSwipePanelGeometry(CachedGeometry);
+	return GetViewOffsetFraction(SwipePanelGeometry, GetContentSize(SwipePanelGeometry));
+}
+
+float SSwipeBox::GetViewOffsetFraction(const FGeometry& InSwipePanelGeometry, double InContentSize) const
+{
+	const float ContentSize = static_cast<float>(InContentSize);
 
-	const float ViewFraction = GetViewFraction();
+	const float ViewFraction = GetViewFraction(InSwipePanelGeometry, InContentSize);
 	return FMath::Clamp(DesiredSwipeOffset / ContentSize, 0.f, 1.f - ViewFraction);
 }
 
@@ -462,11 +1212,21 @@ void SSwipeBox::SwipeToEnd()
 void SSwipeBox::SwipeDescendantIntoView(const TSharedPtr<SWidget>& WidgetToSwipeIntoView, bool InAnimateSwipe,
                                         EDescendantScrollDestination InDestination, float InSwipePadding)
 {
-	SwipeIntoViewRequest = [this, WidgetToSwipeIntoView, InAnimateSwipe, InDestination, InSwipePadding
+	// Pages snap in sticky mode, the page holding the widget is all we need and no layout is required.
+	if (AllowStickySwipe == EAllowStickyswipe::Yes && WidgetToSwipeIntoView.IsValid())
+	{
+		SwipePageOfDescendantIntoView(*WidgetToSwipeIntoView, InAnimateSwipe);
+		SwipeIntoViewRequest = nullptr;
+		return;
+	}
+
+	// Only keep a weak reference, the widget may be removed from the box before the request runs.
+	TWeakPtr<SWidget> WeakWidgetToSwipeIntoView = WidgetToSwipeIntoView;
+	SwipeIntoViewRequest = [this, WeakWidgetToSwipeIntoView, InAnimateSwipe, InDestination, InSwipePadding
 		](FGeometry AllottedGeometry)
 		{
-			InternalSwipeDescendantIntoView(AllottedGeometry, WidgetToSwipeIntoView, InAnimateSwipe, InDestination,
-			                                InSwipePadding);
+			InternalSwipeDescendantIntoView(AllottedGeometry, WeakWidgetToSwipeIntoView.Pin(), InAnimateSwipe,
+			                                InDestination, InSwipePadding);
 		};
 
 	// if (AllowStickySwipe == EAllowStickyswipe::No)
@@ -479,22 +1239,15 @@ bool SSwipeBox::InternalSwipeDescendantIntoView(const FGeometry& MyGeometry, con
                                                 bool InAnimateSwipe, EDescendantScrollDestination InDestination,
                                                 float InSwipePadding)
 {
-	// We need to safely find the one WidgetToFind among our descendants.
-	TSet<TSharedRef<SWidget>> WidgetsToFind;
+	if (AllowStickySwipe == EAllowStickyswipe::Yes && WidgetToFind.IsValid())
 	{
-		if (WidgetToFind.IsValid())
-		{
-			WidgetsToFind.Add(WidgetToFind.ToSharedRef());
-		}
+		return SwipePageOfDescendantIntoView(*WidgetToFind, InAnimateSwipe);
 	}
-	TMap<TSharedRef<SWidget>, FArrangedWidget> Result;
-
-	FindChildGeometries(MyGeometry, WidgetsToFind, Result);
 
 	if (WidgetToFind.IsValid())
 	{
-		FArrangedWidget* WidgetGeometry = Result.Find(WidgetToFind.ToSharedRef());
-		if (!WidgetGeometry)
+		FGeometry WidgetGeometry;
+		if (!FindDescendantGeometry(MyGeometry, *WidgetToFind, WidgetGeometry))
 		{
 			UE_LOG(LogSlate, Warning, TEXT("Unable to Swipe to descendant as it's not a child of the Swipebox"));
 		}
@@ -505,7 +1258,7 @@ bool SSwipeBox::InternalSwipeDescendantIntoView(const FGeometry& MyGeometry, con
 			{
 				// Calculate how much we would need to Swipe to bring this to the top/left of the Swipe box
 				const float WidgetPosition = GetSwipeComponentFromVector(
-					MyGeometry.AbsoluteToLocal(WidgetGeometry->Geometry.GetAbsolutePosition()));
+					MyGeometry.AbsoluteToLocal(WidgetGeometry.GetAbsolutePosition()));
 				const float MyPosition = InSwipePadding;
 				SwipeOffset = WidgetPosition - MyPosition;
 			}
@@ -514,7 +1267,7 @@ bool SSwipeBox::InternalSwipeDescendantIntoView(const FGeometry& MyGeometry, con
 				// Calculate how much we would need to Swipe to bring this to the bottom/right of the Swipe box
 				const float WidgetPosition = GetSwipeComponentFromVector(
 					MyGeometry.AbsoluteToLocal(
-						WidgetGeometry->Geometry.GetAbsolutePosition() + WidgetGeometry->Geometry.GetAbsoluteSize()) -
+						WidgetGeometry.GetAbsolutePosition() + WidgetGeometry.GetAbsoluteSize()) -
 					MyGeometry.GetLocalSize());
 				const float MyPosition = InSwipePadding;
 				SwipeOffset = WidgetPosition - MyPosition;
@@ -523,17 +1276,16 @@ bool SSwipeBox::InternalSwipeDescendantIntoView(const FGeometry& MyGeometry, con
 			{
 				// Calculate how much we would need to Swipe to bring this to the top/left of the Swipe box
 				const float WidgetPosition = GetSwipeComponentFromVector(
-					MyGeometry.AbsoluteToLocal(WidgetGeometry->Geometry.GetAbsolutePosition()) + (WidgetGeometry->
-						Geometry.GetLocalSize() / 2));
+					MyGeometry.AbsoluteToLocal(WidgetGeometry.GetAbsolutePosition()) + (WidgetGeometry.GetLocalSize() / 2));
 				const float MyPosition = GetSwipeComponentFromVector(MyGeometry.GetLocalSize() * FVector2f(0.5f, 0.5f));
 				SwipeOffset = WidgetPosition - MyPosition;
 			}
 			else
 			{
 				const float WidgetStartPosition = GetSwipeComponentFromVector(
-					MyGeometry.AbsoluteToLocal(WidgetGeometry->Geometry.GetAbsolutePosition()));
+					MyGeometry.AbsoluteToLocal(WidgetGeometry.GetAbsolutePosition()));
 				const float WidgetEndPosition = WidgetStartPosition + GetSwipeComponentFromVector(
-					WidgetGeometry->Geometry.GetLocalSize());
+					WidgetGeometry.GetLocalSize());
 				const float ViewStartPosition = InSwipePadding;
 				const float ViewEndPosition = GetSwipeComponentFromVector(MyGeometry.GetLocalSize() - InSwipePadding);
 
@@ -552,7 +1304,7 @@ bool SSwipeBox::InternalSwipeDescendantIntoView(const FGeometry& MyGeometry, con
 
 			if (SwipeOffset != 0.0f)
 			{
-				DesiredSwipeOffset = SwipePanel->PhysicalOffset;
+				DesiredSwipeOffset = static_cast<float>(SwipePanel->PhysicalOffset);
 				SwipeBy(MyGeometry, SwipeOffset, EAllowOverscroll::No, InAnimateSwipe);
 			}
 
@@ -563,6 +1315,23 @@ bool SSwipeBox::InternalSwipeDescendantIntoView(const FGeometry& MyGeometry, con
 	return false;
 }
 
+bool SSwipeBox::SwipePageOfDescendantIntoView(const SWidget& WidgetToFind, bool InAnimateSwipe)
+{
+	const int32 PageIndex = SwipePanel->FindPageIndex(WidgetToFind);
+	if (PageIndex == INDEX_NONE)
+	{
+		UE_LOG(LogSlate, Warning, TEXT("Unable to Swipe to descendant as it's not a child of the Swipebox"));
+		return false;
+	}
+
+	if (PageIndex != StickySwipe.GetCurrentPage())
+	{
+		StickySwipe.SetCurrentPage(PageIndex, true, InAnimateSwipe);
+		Invalidate(EInvalidateWidget::Layout);
+	}
+	return true;
+}
+
 void SSwipeBox::SetStyle(const FSwipeBoxStyle* InStyle)
 {
 	if (Style != InStyle)
@@ -597,6 +1366,16 @@ void SSwipeBox::InvalidateSwipeBarStyle()
 	}
 }
 
+const FSwipeLatencyHistogram& SSwipeBox::GetInputLatency() const
+{
+	return SwipePanel->InputLatency;
+}
+
+void SSwipeBox::ResetInputLatency()
+{
+	SwipePanel->InputLatency.Reset();
+}
+
 EOrientation SSwipeBox::GetOrientation()
 {
 	return Orientation;
@@ -733,6 +1512,10 @@ return EActiveTimerReturnType::Stop;
 
 void SSwipeBox::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
+#if WITH_SLATE_DEBUGGING
+	const uint64 DebugTickStartCycles = FPlatformTime::Cycles64();
+#endif
+
 	CachedGeometry = AllottedGeometry;
 
 	if (AllowStickySwipe == EAllowStickyswipe::No && (bTouchPanningCapture && (FSlateApplication::Get().GetCurrentTime()
@@ -748,19 +1531,19 @@ void SSwipeBox::Tick(const FGeometry& AllottedGeometry, const double InCurrentTi
 		SwipeIntoViewRequest = nullptr;
 	}
 
-	const FGeometry SwipePanelGeometry = FindChildGeometry(AllottedGeometry, SwipePanel.ToSharedRef());
-	const float ContentSize = GetSwipeComponentFromVector(SwipePanel->GetDesiredSize());
+	const FGeometry SwipePanelGeometry = GetSwipePanelGeometry(AllottedGeometry);
+	const double ContentSize = GetContentSize(SwipePanelGeometry);
 
 	if (bSwipeToEnd)
 	{
-		DesiredSwipeOffset = FMath::Max(ContentSize - GetSwipeComponentFromVector(SwipePanelGeometry.GetLocalSize()),
-		                                0.0f);
+		DesiredSwipeOffset = static_cast<float>(FMath::Max(
+			ContentSize - GetSwipeComponentFromVector(SwipePanelGeometry.GetLocalSize()), 0.0));
 		bSwipeToEnd = false;
 	}
 
 	// If this Swipe box has no size, do not compute a view fraction because it will be wrong and causes pop in when the size is available
-	const float ViewFraction = GetViewFraction();
-	const float TargetViewOffset = GetViewOffsetFraction();
+	const float ViewFraction = GetViewFraction(SwipePanelGeometry, ContentSize);
+	const float TargetViewOffset = GetViewOffsetFraction(SwipePanelGeometry, ContentSize);
 
 	const float CurrentViewOffset = bAnimateSwipe
 		                                ? FMath::FInterpTo(SwipeBar->DistanceFromTop(), TargetViewOffset, InDeltaTime,
@@ -768,7 +1551,7 @@ void SSwipeBox::Tick(const FGeometry& AllottedGeometry, const double InCurrentTi
 		                                : TargetViewOffset;
 
 	// Update the Swipebar with the clamped version of the offset
-	float NewPhysicalOffset = GetSwipeComponentFromVector(CurrentViewOffset * SwipePanel->GetDesiredSize());
+	double NewPhysicalOffset = CurrentViewOffset * ContentSize;
 	if (AllowOverSwipe == EAllowOverscroll::Yes)
 	{
 		NewPhysicalOffset += OverSwipe.GetOverscroll(AllottedGeometry);
@@ -776,7 +1559,7 @@ void SSwipeBox::Tick(const FGeometry& AllottedGeometry, const double InCurrentTi
 	if (AllowStickySwipe == EAllowStickyswipe::Yes)
 	{
 		NewPhysicalOffset += StickySwipe.GetStickyswipe(AllottedGeometry);
-		bool Changepage = StickySwipe.UpdateStickyswipe(SwipePanel.ToSharedRef(), CachedGeometry, InDeltaTime);
+		bool Changepage = StickySwipe.UpdateStickyswipe(*SwipePanel, CachedGeometry, InDeltaTime);
 		if (Changepage)
 		{
 			OnUserSwipeed.ExecuteIfBound(StickySwipe.GetCurrentPage());
@@ -784,10 +1567,31 @@ void SSwipeBox::Tick(const FGeometry& AllottedGeometry, const double InCurrentTi
 	}
 
 	const bool bWasSwipeing = bIsSwipeing;
-	bIsSwipeing = !FMath::IsNearlyEqual(NewPhysicalOffset, SwipePanel->PhysicalOffset, 0.001f);
+	bIsSwipeing = !FMath::IsNearlyEqual(NewPhysicalOffset, SwipePanel->PhysicalOffset, 0.001);
 
 	SwipePanel->PhysicalOffset = NewPhysicalOffset;
 
+	if (PendingInputTime > 0.0)
+	{
+		// Keep the oldest move if the panel has not been arranged since the previous hand-off.
+		if (SwipePanel->PendingInputTime == 0.0)
+		{
+			SwipePanel->PendingInputTime = PendingInputTime;
+		}
+		PendingInputTime = 0.0;
+	}
+
+	if (SwipePanel->bPagesHitTestInvisible && !bTouchPanningCapture && !bIsSwipeing)
+	{
+		// The pages settled, they are hit tested again from the repaint below.
+		SwipePanel->bPagesHitTestInvisible = false;
+		if (!bWasSwipeing)
+		{
+			// Released without moving the pages, nothing repaints them otherwise.
+			SwipePanel->Invalidate(EInvalidateWidgetReason::Paint);
+		}
+	}
+
 	if (bWasSwipeing && !bIsSwipeing)
 	{
 		Invalidate(EInvalidateWidget::Layout);
@@ -797,12 +1601,24 @@ void SSwipeBox::Tick(const FGeometry& AllottedGeometry, const double InCurrentTi
 	if (!SwipeBar->IsNeeded())
 	{
 		// We cannot Swipe, so ensure that there is no offset.
-		SwipePanel->PhysicalOffset = 0.0f;
+		SwipePanel->PhysicalOffset = 0.0;
 	}
+
+	UpdatePageLifecycle();
+
+#if WITH_SLATE_DEBUGGING
+	DebugOverlay.TickMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - DebugTickStartCycles);
+#endif
 }
 
 bool SSwipeBox::ComputeVolatility() const
 {
+#if WITH_SLATE_DEBUGGING
+	if (SwipeBoxPrivate::CVarDebugOverlay.GetValueOnGameThread())
+	{
+		return true;
+	}
+#endif
 	return bIsSwipeing || IsRightClickSwipeing();
 }
 
@@ -912,6 +1728,9 @@ FReply SSwipeBox::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent&
 					bTouchPanningCapture = true;
 					SwipeBar->BeginSwipeing();
 
+					// The drag invalidates the layout on every move, the pages leave the hit test grid with the next repaint.
+					SwipePanel->bPagesHitTestInvisible = bSuspendPageHitTestWhileSwiping;
+
 					// The user has moved the list some amount; they are probably
 					// trying to Swipe. From now on, the list assumes the user is Swipeing
 					// until they lift their finger.
@@ -925,10 +1744,26 @@ FReply SSwipeBox::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent&
 		}
 		else
 		{
-			if (bFingerOwningTouchInteraction.IsSet() && HasMouseCaptureByUser(
-				MouseEvent.GetUserIndex(), MouseEvent.GetPointerIndex()))
+			if (bFingerOwningTouchInteraction.IsSet() && (bAssumeTouchCaptureForTesting || HasMouseCaptureByUser(
+				MouseEvent.GetUserIndex(), MouseEvent.GetPointerIndex())))
 			{
 				LastSwipeTime = FSlateApplication::Get().GetCurrentTime();
+				if (PendingInputTime == 0.0)
+				{
+					// FPointerEvent carries no timestamp, the event is stamped on arrival instead.
+					PendingInputTime = FPlatformTime::Seconds();
+				}
+#if WITH_SLATE_DEBUGGING
+				{
+					const double MoveTime = FPlatformTime::Seconds();
+					if (DebugOverlay.LastMoveTime > 0.0 && MoveTime > DebugOverlay.LastMoveTime)
+					{
+						const float MoveVelocity = -SwipeByAmountLocal / static_cast<float>(MoveTime - DebugOverlay.LastMoveTime);
+						DebugOverlay.DragVelocity = FMath::Lerp(DebugOverlay.DragVelocity, MoveVelocity, 0.5f);
+					}
+					DebugOverlay.LastMoveTime = MoveTime;
+				}
+#endif
 				if (AllowStickySwipe == EAllowStickyswipe::No)
 				{
 					InertialSwipeManager.AddScrollSample(-SwipeByAmountScreen,
@@ -1060,8 +1895,8 @@ bool SSwipeBox::SwipeBy(const FGeometry& AllottedGeometry, float LocalSwipeAmoun
 
 	bAnimateSwipe = InAnimateSwipe;
 
-	const float ContentSize = GetSwipeComponentFromVector(SwipePanel->GetDesiredSize());
-	const FGeometry SwipePanelGeometry = FindChildGeometry(AllottedGeometry, SwipePanel.ToSharedRef());
+	const FGeometry SwipePanelGeometry = GetSwipePanelGeometry(AllottedGeometry);
+	const float ContentSize = static_cast<float>(GetContentSize(SwipePanelGeometry));
 
 	const float PreviousSwipeOffset = DesiredSwipeOffset;
 
@@ -1112,7 +1947,7 @@ FReply SSwipeBox::OnTouchEnded(const FGeometry& MyGeometry, const FPointerEvent&
 {
 	CachedGeometry = MyGeometry;
 
-	if (HasMouseCaptureByUser(InTouchEvent.GetUserIndex(), InTouchEvent.GetPointerIndex()))
+	if (bAssumeTouchCaptureForTesting || HasMouseCaptureByUser(InTouchEvent.GetUserIndex(), InTouchEvent.GetPointerIndex()))
 	{
 		SwipeBar->EndSwipeing();
 		Invalidate(EInvalidateWidget::Layout);
@@ -1126,6 +1961,12 @@ FReply SSwipeBox::OnTouchEnded(const FGeometry& MyGeometry, const FPointerEvent&
 			StickySwipe.OnUserReleaseInterraction();
 		}
 
+#if WITH_SLATE_DEBUGGING
+		DebugOverlay.ReleaseVelocity = DebugOverlay.DragVelocity;
+		DebugOverlay.DragVelocity = 0.f;
+		DebugOverlay.LastMoveTime = 0.0;
+#endif
+
 		return FReply::Handled().ReleaseMouseCapture();
 	}
 
@@ -1149,14 +1990,13 @@ FNavigationReply SSwipeBox::OnNavigation(const FGeometry& MyGeometry, const FNav
 
 	// Find the child with focus currently so that we can find the next logical child we're going to move to.
 	TPanelChildren<SSwipeBox::FSlot>& Children = SwipePanel->Children;
-	for (int32 SlotIndex = 0; SlotIndex < Children.Num(); ++SlotIndex)
+	if (FSlateApplication::IsInitialized())
 	{
-		if (Children[SlotIndex].GetWidget()->HasUserFocus(InNavigationEvent.GetUserIndex()).IsSet() ||
-			Children[SlotIndex].GetWidget()->HasUserFocusedDescendants(InNavigationEvent.GetUserIndex()))
+		const TSharedPtr<SWidget> FocusedWidget = FSlateApplication::Get().GetUserFocusedWidget(InNavigationEvent.GetUserIndex());
+		FocusedChildIndex = FocusedWidget.IsValid() ? SwipePanel->FindPageIndex(*FocusedWidget) : INDEX_NONE;
+		if (FocusedChildIndex != INDEX_NONE)
 		{
-			FocusedChild = Children[SlotIndex].GetWidget();
-			FocusedChildIndex = SlotIndex;
-			break;
+			FocusedChild = Children[FocusedChildIndex].GetWidget();
 		}
 	}
 
@@ -1199,20 +2039,8 @@ FNavigationReply SSwipeBox::OnNavigation(const FGeometry& MyGeometry, const FNav
 		// the new child we're moving focus to.
 		if (FocusedChildDirection != 0)
 		{
-			TSharedPtr<SWidget> NextFocusableChild;
-
 			// Search in the direction we need to move for the next focusable child of the Swipebox.
-			for (int32 ChildIndex = FocusedChildIndex + FocusedChildDirection; ChildIndex >= 0 && ChildIndex < Children.
-			     Num(); ChildIndex += FocusedChildDirection)
-			{
-				TSharedPtr<SWidget> PossiblyFocusableChild = GetKeyboardFocusableWidget(
-					Children[ChildIndex].GetWidget());
-				if (PossiblyFocusableChild.IsValid())
-				{
-					NextFocusableChild = PossiblyFocusableChild;
-					break;
-				}
-			}
+			TSharedPtr<SWidget> NextFocusableChild = FindNextKeyboardFocusableWidget(FocusedChildIndex, FocusedChildDirection);
 
 			// If we found a focusable child, Swipe to it, and shift focus.
 			if (NextFocusableChild.IsValid())
@@ -1241,6 +2069,157 @@ void SSwipeBox::OnFocusChanging(const FWeakWidgetPath& PreviousFocusPath, const
 	}
 }
 
+void SSwipeBox::InvalidateKeyboardFocusCache(int32 PageIndex)
+{
+	// Skip pointers may jump over the invalidated page, they are all dropped.
+	++FocusSkipGeneration;
+
+	if (PageIndex == INDEX_NONE)
+	{
+		++FocusCacheGeneration;
+	}
+	else if (FocusCache.IsValidIndex(PageIndex))
+	{
+		FocusCache[PageIndex].Generation = 0;
+	}
+}
+
+bool SSwipeBox::IsCachedFocusableStillValid(const SWidget& InFocusable, const SWidget& InPage) const
+{
+	if (!InFocusable.SupportsKeyboardFocus())
+	{
+		return false;
+	}
+
+	// Every widget between the page and the focusable widget must still be visible, and the widget must still be in the page.
+	const SWidget* Widget = &InFocusable;
+	while (Widget != nullptr)
+	{
+		if (!EVisibility::DoesVisibilityPassFilter(Widget->GetVisibility(), EVisibility::Visible))
+		{
+			return false;
+		}
+		if (Widget == &InPage)
+		{
+			return true;
+		}
+		Widget = Widget->GetParentWidget().Get();
+	}
+	return false;
+}
+
+TSharedPtr<SWidget> SSwipeBox::GetPageKeyboardFocusableWidget(int32 PageIndex)
+{
+	const TSharedRef<SWidget>& Page = SwipePanel->Children[PageIndex].GetWidget();
+	const EVisibility PageVisibility = Page->GetVisibility();
+
+	if (FocusCache.Num() != SwipePanel->Children.Num())
+	{
+		FocusCache.SetNum(SwipePanel->Children.Num());
+	}
+
+	FFocusCacheEntry& Entry = FocusCache[PageIndex];
+	if (Entry.Generation == FocusCacheGeneration && Entry.Page == &Page.Get() && Entry.PageVisibility == PageVisibility)
+	{
+		if (!Entry.bHasFocusable)
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<SWidget> CachedFocusable = Entry.Focusable.Pin();
+		if (CachedFocusable.IsValid() && IsCachedFocusableStillValid(*CachedFocusable, Page.Get()))
+		{
+			return CachedFocusable;
+		}
+	}
+
+	// The page changed since the last search, pages skipped because of it may be wrong too.
+	if (Entry.Generation != 0)
+	{
+		++FocusSkipGeneration;
+	}
+
+	TSharedPtr<SWidget> Focusable = GetKeyboardFocusableWidget(Page);
+	Entry.Focusable = Focusable;
+	Entry.Page = &Page.Get();
+	Entry.PageVisibility = PageVisibility;
+	Entry.Generation = FocusCacheGeneration;
+	Entry.bHasFocusable = Focusable.IsValid();
+	return Focusable;
+}
+
+TSharedPtr<SWidget> SSwipeBox::FindNextKeyboardFocusableWidget(int32 FromPageIndex, int32 Direction)
+{
+	const int32 NumPages = SwipePanel->Children.Num();
+	const int32 DirectionIndex = Direction > 0 ? 1 : 0;
+	auto GetNextPage = [this, Direction, DirectionIndex](int32 PageIndex)
+	{
+		const FFocusCacheEntry* Entry = FocusCache.IsValidIndex(PageIndex) ? &FocusCache[PageIndex] : nullptr;
+		if (Entry && Entry->SkipGeneration[DirectionIndex] == FocusSkipGeneration)
+		{
+			return Entry->SkipTo[DirectionIndex];
+		}
+		return PageIndex + Direction;
+	};
+
+	// A skip pointer only holds while its page has the content and visibility the entry was computed for. A page
+	// swapped or shown again without an invalidation drops every skip pointer, this one included.
+	auto HasValidSkip = [this, DirectionIndex](int32 PageIndex, const FFocusCacheEntry* Entry)
+	{
+		if (!Entry || Entry->SkipGeneration[DirectionIndex] != FocusSkipGeneration)
+		{
+			return false;
+		}
+		const TSharedRef<SWidget>& Page = SwipePanel->Children[PageIndex].GetWidget();
+		if (Entry->Page != &Page.Get() || Entry->PageVisibility != Page->GetVisibility())
+		{
+			++FocusSkipGeneration;
+			return false;
+		}
+		return true;
+	};
+
+	// Walk the pages, jumping over runs of pages already known to have nothing focusable.
+	const uint32 StartSkipGeneration = FocusSkipGeneration;
+	TSharedPtr<SWidget> Focusable;
+	int32 PageIndex = FromPageIndex + Direction;
+	while (PageIndex >= 0 && PageIndex < NumPages)
+	{
+		const FFocusCacheEntry* Entry = FocusCache.IsValidIndex(PageIndex) ? &FocusCache[PageIndex] : nullptr;
+		if (HasValidSkip(PageIndex, Entry))
+		{
+			PageIndex = Entry->SkipTo[DirectionIndex];
+			continue;
+		}
+
+		Focusable = GetPageKeyboardFocusableWidget(PageIndex);
+		if (Focusable.IsValid())
+		{
+			break;
+		}
+		PageIndex += Direction;
+	}
+
+	// A page changed during the walk, what was jumped over may be stale: do not record it.
+	if (StartSkipGeneration != FocusSkipGeneration)
+	{
+		return Focusable;
+	}
+
+	// Path compression: every unfocusable page crossed now jumps straight to the result (or past the end).
+	const int32 SkipTarget = FMath::Clamp(PageIndex, -1, NumPages);
+	for (int32 CrossedPage = FromPageIndex + Direction; CrossedPage >= 0 && CrossedPage < NumPages && CrossedPage != SkipTarget;)
+	{
+		const int32 NextPage = GetNextPage(CrossedPage);
+		FFocusCacheEntry& CrossedEntry = FocusCache[CrossedPage];
+		CrossedEntry.SkipTo[DirectionIndex] = SkipTarget;
+		CrossedEntry.SkipGeneration[DirectionIndex] = FocusSkipGeneration;
+		CrossedPage = NextPage;
+	}
+
+	return Focusable;
+}
+
 TSharedPtr<SWidget> SSwipeBox::GetKeyboardFocusableWidget(TSharedPtr<SWidget> InWidget)
 {
 	if (EVisibility::DoesVisibilityPassFilter(InWidget->GetVisibility(), EVisibility::Visible))
@@ -1271,9 +2250,21 @@ int32 SSwipeBox::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeomet
                          FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
                          bool bParentEnabled) const
 {
+#if WITH_SLATE_DEBUGGING
+	const uint64 DebugPaintStartCycles = FPlatformTime::Cycles64();
+#endif
+
 	int32 NewLayerId = SCompoundWidget::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId,
 	                                            InWidgetStyle, bParentEnabled);
 
+#if WITH_SLATE_DEBUGGING
+	if (SwipeBoxPrivate::CVarDebugOverlay.GetValueOnGameThread())
+	{
+		DebugOverlay.PaintMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - DebugPaintStartCycles);
+		NewLayerId = PaintDebugOverlay(AllottedGeometry, OutDrawElements, NewLayerId);
+	}
+#endif
+
 	if (!bShowSoftwareCursor)
 	{
 		return NewLayerId;
@@ -1293,6 +2284,95 @@ int32 SSwipeBox::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeomet
 	return NewLayerId;
 }
 
+#if WITH_SLATE_DEBUGGING
+
+int32 SSwipeBox::PaintDebugOverlay(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements,
+                                   int32 LayerId) const
+{
+	const FGeometry PanelGeometry = SwipePanel->GetPaintSpaceGeometry();
+	const FVector2f PanelSize = PanelGeometry.GetLocalSize();
+
+	// Page boundaries as laid out by the last arrange pass, highlighted when the page intersects the view. Arranging
+	// again from here would consume the pending latency sample and overwrite the spans the overlay reports.
+	const FSlateBrush* BorderBrush = FCoreStyle::Get().GetBrush(TEXT("Debug.Border"));
+	const TConstArrayView<FVector2d> PageSpans = SwipePanel->GetArrangedPageSpans();
+	const FInt32Interval* ArrangedPages = SwipePanel->ArrangedPages.GetPtrOrNull();
+	const double ChildrenOffset = SwipePanel->GetChildrenOffset(SwipePanel->GetArrangedPhysicalOffset());
+	const float ViewExtent = GetSwipeComponentFromVector(PanelSize);
+	int32 NumPagesArranged = 0;
+	int32 NumPagesInView = 0;
+	++LayerId;
+	for (int32 PageIndex = 0; PageIndex < PageSpans.Num(); ++PageIndex)
+	{
+		const FVector2d& Span = PageSpans[PageIndex];
+		if (Span.Y <= Span.X || (ArrangedPages && !ArrangedPages->Contains(PageIndex)))
+		{
+			continue;
+		}
+		++NumPagesArranged;
+
+		const float Start = static_cast<float>(Span.X + ChildrenOffset);
+		const float Length = static_cast<float>(Span.Y - Span.X);
+		const bool bInView = Start + Length > 0.f && Start < ViewExtent;
+		NumPagesInView += bInView ? 1 : 0;
+
+		const FVector2f PagePosition = Orientation == Orient_Vertical ? FVector2f(0.f, Start) : FVector2f(Start, 0.f);
+		const FVector2f PageSize = Orientation == Orient_Vertical
+			                           ? FVector2f(PanelSize.X, Length)
+			                           : FVector2f(Length, PanelSize.Y);
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+		                           PanelGeometry.ToPaintGeometry(PageSize, FSlateLayoutTransform(PagePosition)),
+		                           BorderBrush, ESlateDrawEffect::None,
+		                           bInView ? FLinearColor::Yellow : FLinearColor(0.5f, 0.5f, 0.f, 0.5f));
+	}
+
+	// Leading edge of the page the sticky swipe is snapping to.
+	const float TargetPosition = static_cast<float>(StickySwipe.GetTargetPoint() - SwipePanel->PhysicalOffset)
+		+ (BackPadSwipeing ? GetSwipeComponentFromVector(PanelSize) : 0.f);
+	TArray<FVector2f> TargetLine;
+	if (Orientation == Orient_Vertical)
+	{
+		TargetLine = {FVector2f(0.f, TargetPosition), FVector2f(PanelSize.X, TargetPosition)};
+	}
+	else
+	{
+		TargetLine = {FVector2f(TargetPosition, 0.f), FVector2f(TargetPosition, PanelSize.Y)};
+	}
+	FSlateDrawElement::MakeLines(OutDrawElements, ++LayerId, PanelGeometry.ToPaintGeometry(), TargetLine,
+	                             ESlateDrawEffect::None, FLinearColor(0.f, 1.f, 1.f), true, 2.f);
+
+	const FString Text = FString::Printf(
+		TEXT("Page %d / %d  Mode %s\n")
+		TEXT("Target %.1f  Offset %.1f  Sticky %.1f\n")
+		TEXT("Release velocity %.1f\n")
+		TEXT("Pages realized %d  arranged %d  in view %d\n")
+		TEXT("Tick %.3f ms  Paint %.3f ms\n")
+		TEXT("Looseness %.1f  Validation %.2f"),
+		StickySwipe.GetCurrentPage(), SwipePanel->Children.Num(),
+		StickySwipe.GetMode() == EStickyMode::StickyToTarget ? TEXT("StickyToTarget") : TEXT("StickyToOrigin"),
+		StickySwipe.GetTargetPoint(), SwipePanel->PhysicalOffset, StickySwipe.GetStickyswipeAmount(),
+		DebugOverlay.ReleaseVelocity,
+		GetNumRealizedPages(), NumPagesArranged, NumPagesInView,
+		DebugOverlay.TickMs, DebugOverlay.PaintMs,
+		StickySwipe.GetLooseness(), StickySwipe.GetScreenPercentDistanceUserChangePage());
+
+	const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Mono", 9);
+	const FVector2f TextSize = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()->Measure(Text, Font);
+	const FVector2f TextPosition(4.f, 4.f);
+
+	FSlateDrawElement::MakeBox(OutDrawElements, ++LayerId,
+	                           AllottedGeometry.ToPaintGeometry(TextSize + FVector2f(8.f, 8.f), FSlateLayoutTransform(TextPosition - FVector2f(4.f, 4.f))),
+	                           FCoreStyle::Get().GetBrush(TEXT("GenericWhiteBox")), ESlateDrawEffect::None,
+	                           FLinearColor(0.f, 0.f, 0.f, 0.6f));
+	FSlateDrawElement::MakeText(OutDrawElements, ++LayerId,
+	                            AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(TextPosition)),
+	                            Text, Font, ESlateDrawEffect::None, FLinearColor::White);
+
+	return LayerId;
+}
+
+#endif
+
 void SSwipeBox::SwipeBar_OnUserSwipeed(int32 InPage)
 {
 	bAnimateSwipe = false;
@@ -1308,7 +2388,7 @@ const float ShadowFadeDistance = 320.0f;
 FSlateColor SSwipeBox::GetStartShadowOpacity() const
 {
 	// The shadow should only be visible when the user needs a hint that they can Swipe up.
-	const float ShadowOpacity = FMath::Clamp(SwipePanel->PhysicalOffset / ShadowFadeDistance, 0.0f, 1.0f);
+	const float ShadowOpacity = static_cast<float>(FMath::Clamp(SwipePanel->PhysicalOffset / ShadowFadeDistance, 0.0, 1.0));
 
 	return FLinearColor(1.0f, 1.0f, 1.0f, ShadowOpacity);
 }
@@ -1319,7 +2399,7 @@ FSlateColor SSwipeBox::GetEndShadowOpacity() const
 	// const float ShadowOpacity = (SwipeBar->DistanceFromBottom() * GetSwipeComponentFromVector(
 	// 	SwipePanel->GetDesiredSize()) / ShadowFadeDistance);
 	// StickySwipe.
-	const float ShadowOpacity = StickySwipe.GetDistanceFromEnd() / ShadowFadeDistance;
+	const float ShadowOpacity = static_cast<float>(StickySwipe.GetDistanceFromEnd() / ShadowFadeDistance);
 	return FLinearColor(1.0f, 1.0f, 1.0f, ShadowOpacity);
 }
 
@@ -1398,6 +2478,11 @@ int SSwipeBox::GetCurrentPage() const
 	return StickySwipe.GetCurrentPage();
 }
 
+float SSwipeBox::GetPagePosition() const
+{
+	return static_cast<float>(StickySwipe.GetPagePosition());
+}
+
 void SSwipeBox::SetCurrentPage(int NewPage)
 {
 	StickySwipe.SetCurrentPage(NewPage, true, true);
@@ -1443,6 +2528,127 @@ void SSwipeBox::SetSwipeWhenFocusChanges(EScrollWhenFocusChanges NewSwipeWhenFoc
 	SwipeWhenFocusChanges = NewSwipeWhenFocusChanges;
 }
 
+void SSwipeBox::SetSuspendOffscreenPages(bool bInSuspendOffscreenPages)
+{
+	if (bSuspendOffscreenPages != bInSuspendOffscreenPages)
+	{
+		bSuspendOffscreenPages = bInSuspendOffscreenPages;
+		SwipePanel->ArrangedPages.Reset();
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SSwipeBox::SetSuspendPageHitTestWhileSwiping(bool bInSuspendPageHitTestWhileSwiping)
+{
+	bSuspendPageHitTestWhileSwiping = bInSuspendPageHitTestWhileSwiping;
+	if (!bSuspendPageHitTestWhileSwiping && SwipePanel->bPagesHitTestInvisible)
+	{
+		SwipePanel->bPagesHitTestInvisible = false;
+		SwipePanel->Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+FInt32Interval SSwipeBox::GetPagesInView() const
+{
+	return SwipePanel->GetPagesInView(SwipePanel->GetArrangedPhysicalOffset());
+}
+
+void SSwipeBox::UpdatePageLifecycle()
+{
+	const FInt32Interval Shown = GetPagesInView();
+	// Pages the offset of this frame brings into view, they are only laid out by the next arrange pass.
+	const FInt32Interval Upcoming = SwipePanel->GetPagesInView(SwipePanel->PhysicalOffset);
+
+	const auto FindPage = [](const TArray<TWeakPtr<SWidget>>& InPages, const TSharedRef<SWidget>& InPage)
+	{
+		return InPages.IndexOfByPredicate([&InPage](const TWeakPtr<SWidget>& Page) { return Page.HasSameObject(&InPage.Get()); });
+	};
+
+	if (Upcoming.IsValid())
+	{
+		for (int32 PageIndex = Upcoming.Min; PageIndex <= Upcoming.Max; ++PageIndex)
+		{
+			const TSharedRef<SWidget>& Page = SwipePanel->Children[PageIndex].GetWidget();
+			if (FindPage(AppearedPages, Page) == INDEX_NONE && FindPage(AppearingPages, Page) == INDEX_NONE)
+			{
+				AppearingPages.Add(Page);
+				OnPageWillAppear.ExecuteIfBound(PageIndex);
+			}
+		}
+	}
+
+	if (Shown.IsValid())
+	{
+		for (int32 PageIndex = Shown.Min; PageIndex <= Shown.Max; ++PageIndex)
+		{
+			const TSharedRef<SWidget>& Page = SwipePanel->Children[PageIndex].GetWidget();
+			if (FindPage(AppearedPages, Page) != INDEX_NONE)
+			{
+				continue;
+			}
+			const int32 AppearingIndex = FindPage(AppearingPages, Page);
+			if (AppearingIndex != INDEX_NONE)
+			{
+				AppearingPages.RemoveAtSwap(AppearingIndex, 1, false);
+			}
+			else
+			{
+				OnPageWillAppear.ExecuteIfBound(PageIndex);
+			}
+			AppearedPages.Add(Page);
+			OnPageDidAppear.ExecuteIfBound(PageIndex);
+		}
+	}
+
+	// Pages that left the view, or were announced and swiped back out before being laid out. Removed pages are
+	// dropped silently, their index no longer means anything.
+	const auto DisappearPages = [this](TArray<TWeakPtr<SWidget>>& InPages, const FInt32Interval& InKeptPages)
+	{
+		for (int32 Index = InPages.Num() - 1; Index >= 0; --Index)
+		{
+			const TSharedPtr<SWidget> Page = InPages[Index].Pin();
+			const int32 PageIndex = Page.IsValid() ? SwipePanel->FindPageIndex(*Page) : INDEX_NONE;
+			if (PageIndex != INDEX_NONE && InKeptPages.Contains(PageIndex))
+			{
+				continue;
+			}
+			InPages.RemoveAtSwap(Index, 1, false);
+			if (PageIndex != INDEX_NONE)
+			{
+				OnPageDidDisappear.ExecuteIfBound(PageIndex);
+			}
+		}
+	};
+	DisappearPages(AppearedPages, Shown);
+
+	FInt32Interval Announced = Upcoming;
+	if (Shown.IsValid())
+	{
+		Announced.Include(Shown.Min);
+		Announced.Include(Shown.Max);
+	}
+	DisappearPages(AppearingPages, Announced);
+
+	if (bSuspendOffscreenPages)
+	{
+		// Without page extents, right after the pages changed, everything is arranged once to measure them again.
+		if (Announced.IsValid())
+		{
+			const FInt32Interval* ArrangedPages = SwipePanel->ArrangedPages.GetPtrOrNull();
+			if (!ArrangedPages || ArrangedPages->Min != Announced.Min || ArrangedPages->Max != Announced.Max)
+			{
+				SwipePanel->ArrangedPages = Announced;
+				SwipePanel->Invalidate(EInvalidateWidgetReason::Layout);
+			}
+		}
+		else if (SwipePanel->ArrangedPages.IsSet())
+		{
+			SwipePanel->ArrangedPages.Reset();
+			SwipePanel->Invalidate(EInvalidateWidgetReason::Layout);
+		}
+	}
+}
+
 void SSwipeBox::BeginInertialSwipeing()
 {
 	if (AllowStickySwipe != EAllowStickyswipe::No && !UpdateInertialSwipeHandle.IsValid())
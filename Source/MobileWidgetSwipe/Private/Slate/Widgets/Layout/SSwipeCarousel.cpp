@@ -0,0 +1,262 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Slate/Widgets/Layout/SSwipeCarousel.h"
+
+#include "Layout/ArrangedChildren.h"
+#include "MobileWidgetSwipeStats.h"
+
+SSwipeCarousel::SSwipeCarousel()
+	: Children(this)
+	  , RingHead(0)
+	  , CurrentIndex(0)
+	  , PageDrag(*this)
+	  , LastPageExtent(0.f)
+	  , Orientation(Orient_Horizontal)
+	  , ScreenPercentValidation(0.15f)
+{
+	for (int64& Index : RingIndex)
+	{
+		Index = TNumericLimits<int64>::Min();
+	}
+}
+
+void SSwipeCarousel::Construct(const FArguments& InArgs)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+
+	Orientation = InArgs._Orientation;
+	PageDrag.Easing = InArgs._Easing;
+	PageDrag.BlendExp = InArgs._BlendExp;
+	PageDrag.Speed = InArgs._Speed;
+	ScreenPercentValidation = InArgs._ScreenPercentValidation;
+	OnGeneratePage = InArgs._OnGeneratePage;
+	OnPageChanged = InArgs._OnPageChanged;
+	CurrentIndex = InArgs._InitialIndex;
+
+	for (int32 RingSlot = 0; RingSlot < RingSize; ++RingSlot)
+	{
+		Children.Add(SNew(SBox));
+	}
+	RefreshPages();
+}
+
+void SSwipeCarousel::SetCurrentIndex(int64 InIndex, bool bAnimate)
+{
+	const float PageExtent = GetPageExtent();
+
+	const FIntPoint FinishedStep = PageDrag.FinishPageChange(MakeOffset(PageExtent));
+	if (FinishedStep != FIntPoint::ZeroValue)
+	{
+		StepBy(Orientation == Orient_Horizontal ? FinishedStep.X : FinishedStep.Y);
+	}
+
+	const int64 Delta = InIndex - CurrentIndex;
+	if (Delta == 0)
+	{
+		if (GetAxisOffset() != 0.f)
+		{
+			PageDrag.AnimateTo(FVector2f::ZeroVector);
+		}
+		return;
+	}
+
+	if (bAnimate && FMath::Abs(Delta) == 1 && PageExtent > 0.f)
+	{
+		PageDrag.AnimateTo(MakeOffset(-Delta * PageExtent));
+		return;
+	}
+
+	CurrentIndex = InIndex;
+	for (int32 PageOffset = -1; PageOffset <= 1; ++PageOffset)
+	{
+		BindRingSlot(GetRingSlot(PageOffset), CurrentIndex + PageOffset);
+	}
+	PageDrag.StopAnimation();
+	PageDrag.SetOffset(FVector2f::ZeroVector);
+	Invalidate(EInvalidateWidgetReason::Layout);
+	OnPageChanged.ExecuteIfBound(CurrentIndex);
+}
+
+void SSwipeCarousel::Next()
+{
+	SetCurrentIndex(CurrentIndex + 1, true);
+}
+
+void SSwipeCarousel::Previous()
+{
+	SetCurrentIndex(CurrentIndex - 1, true);
+}
+
+void SSwipeCarousel::RefreshPages()
+{
+	for (int32 PageOffset = -1; PageOffset <= 1; ++PageOffset)
+	{
+		BindRingSlot(GetRingSlot(PageOffset), CurrentIndex + PageOffset, true);
+	}
+}
+
+void SSwipeCarousel::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+{
+	const FVector2f Size = AllottedGeometry.GetLocalSize();
+	const float PageExtent = Orientation == Orient_Horizontal ? Size.X : Size.Y;
+
+	for (int32 PageOffset = -1; PageOffset <= 1; ++PageOffset)
+	{
+		const FVector2f Translation = MakeOffset(PageOffset * PageExtent) + PageDrag.GetOffset();
+		if (PageOffset != 0 && !FSwipePageDrag::IsPageInView(Translation, Size))
+		{
+			continue;
+		}
+
+		const TSharedRef<SBox>& Page = Children[GetRingSlot(PageOffset)];
+		if (ArrangedChildren.Accepts(Page->GetVisibility()))
+		{
+			ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(Page, Size, FSlateLayoutTransform(Translation)));
+		}
+	}
+}
+
+FChildren* SSwipeCarousel::GetChildren()
+{
+	return &Children;
+}
+
+void SSwipeCarousel::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	LastPageExtent = Orientation == Orient_Horizontal
+		                 ? AllottedGeometry.GetLocalSize().X
+		                 : AllottedGeometry.GetLocalSize().Y;
+
+	const FIntPoint Step = PageDrag.TickAnimation(InDeltaTime);
+	if (Step != FIntPoint::ZeroValue)
+	{
+		StepBy(Orientation == Orient_Horizontal ? Step.X : Step.Y);
+	}
+}
+
+FReply SSwipeCarousel::OnPreviewMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	PageDrag.OnPreviewTouchStarted(MouseEvent);
+	return FReply::Unhandled();
+}
+
+FReply SSwipeCarousel::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	return MouseEvent.IsTouchEvent() ? FReply::Handled() : FReply::Unhandled();
+}
+
+FReply SSwipeCarousel::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (TOptional<FReply> Reply = PageDrag.OnTouchMoved(MouseEvent, Orientation))
+	{
+		return Reply.GetValue();
+	}
+
+	const FVector2f CursorDelta = MouseEvent.GetCursorDelta();
+	const float SwipeAmountScreen = Orientation == Orient_Horizontal ? CursorDelta.X : CursorDelta.Y;
+	float NewOffset = GetAxisOffset() + SwipeAmountScreen / MyGeometry.Scale;
+
+	// A long drag crosses several pages, step as each one leaves the screen so the ring keeps up.
+	const float PageExtent = GetPageExtent();
+	if (PageExtent > 0.f)
+	{
+		while (NewOffset <= -PageExtent)
+		{
+			StepBy(1);
+			NewOffset += PageExtent;
+		}
+		while (NewOffset >= PageExtent)
+		{
+			StepBy(-1);
+			NewOffset -= PageExtent;
+		}
+	}
+	PageDrag.SetOffset(MakeOffset(NewOffset));
+
+	return FReply::Handled();
+}
+
+FReply SSwipeCarousel::OnTouchEnded(const FGeometry& MyGeometry, const FPointerEvent& InTouchEvent)
+{
+	return PageDrag.OnTouchEnded(InTouchEvent, [this](EOrientation)
+	{
+		OnDragReleased();
+	});
+}
+
+void SSwipeCarousel::OnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent)
+{
+	SPanel::OnMouseCaptureLost(CaptureLostEvent);
+
+	PageDrag.OnMouseCaptureLost([this](EOrientation)
+	{
+		OnDragReleased();
+	});
+}
+
+FVector2D SSwipeCarousel::ComputeDesiredSize(float) const
+{
+	FVector2D DesiredSize = FVector2D::ZeroVector;
+	for (int32 RingSlot = 0; RingSlot < RingSize; ++RingSlot)
+	{
+		DesiredSize = FVector2D::Max(DesiredSize, FVector2D(Children[RingSlot]->GetDesiredSize()));
+	}
+	return DesiredSize;
+}
+
+float SSwipeCarousel::GetPageExtent() const
+{
+	return LastPageExtent;
+}
+
+void SSwipeCarousel::BindRingSlot(int32 InRingSlot, int64 InLogicalIndex, bool bForce)
+{
+	if (!bForce && RingIndex[InRingSlot] == InLogicalIndex)
+	{
+		return;
+	}
+	RingIndex[InRingSlot] = InLogicalIndex;
+
+	if (OnGeneratePage.IsBound())
+	{
+		LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+		const TSharedRef<SWidget> Page = OnGeneratePage.Execute(InLogicalIndex, RingContent[InRingSlot]);
+		if (Page != RingContent[InRingSlot])
+		{
+			RingContent[InRingSlot] = Page;
+			Children[InRingSlot]->SetContent(Page);
+		}
+	}
+}
+
+void SSwipeCarousel::StepBy(int32 InDirection)
+{
+	CurrentIndex += InDirection;
+	RingHead = GetRingSlot(InDirection);
+
+	// The slot that left on the other side is the only one that needs new content.
+	BindRingSlot(GetRingSlot(InDirection), CurrentIndex + InDirection);
+
+	Invalidate(EInvalidateWidgetReason::Layout);
+	OnPageChanged.ExecuteIfBound(CurrentIndex);
+}
+
+void SSwipeCarousel::OnDragReleased()
+{
+	const float PageExtent = GetPageExtent();
+	const float Threshold = PageExtent * ScreenPercentValidation;
+	const float Offset = GetAxisOffset();
+
+	if (Offset < -Threshold)
+	{
+		PageDrag.AnimateTo(MakeOffset(-PageExtent));
+	}
+	else if (Offset > Threshold)
+	{
+		PageDrag.AnimateTo(MakeOffset(PageExtent));
+	}
+	else
+	{
+		PageDrag.AnimateTo(FVector2f::ZeroVector);
+	}
+}
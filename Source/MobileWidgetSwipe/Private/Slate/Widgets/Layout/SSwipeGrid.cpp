@@ -0,0 +1,324 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Slate/Widgets/Layout/SSwipeGrid.h"
+
+#include "Layout/ArrangedChildren.h"
+#include "MobileWidgetSwipeStats.h"
+
+namespace SwipeGridPrivate
+{
+	/** Fraction of the drag applied when there is no page past the edge of the grid. */
+	constexpr float EdgeResistance = 0.3f;
+
+	/** How far past the edge of the grid a page can be dragged, in fraction of the page. */
+	constexpr float MaxEdgeOverswipe = 0.2f;
+}
+
+SSwipeGrid::SSwipeGrid()
+	: Children(this)
+	  , NumColumns(1)
+	  , NumRows(1)
+	  , CurrentCell(0, 0)
+	  , PageDrag(*this)
+	  , LastPageSize(FVector2f::ZeroVector)
+	  , ScreenPercentValidation(0.15f)
+{
+}
+
+void SSwipeGrid::Construct(const FArguments& InArgs)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+
+	NumColumns = FMath::Max(InArgs._NumColumns, 0);
+	NumRows = FMath::Max(InArgs._NumRows, 0);
+	PageDrag.Easing = InArgs._Easing;
+	PageDrag.BlendExp = InArgs._BlendExp;
+	PageDrag.Speed = InArgs._Speed;
+	ScreenPercentValidation = InArgs._ScreenPercentValidation;
+	OnGeneratePage = InArgs._OnGeneratePage;
+	OnPageChanged = InArgs._OnPageChanged;
+	CurrentCell = FIntPoint(FMath::Clamp(InArgs._InitialCell.X, 0, FMath::Max(NumColumns - 1, 0)),
+	                        FMath::Clamp(InArgs._InitialCell.Y, 0, FMath::Max(NumRows - 1, 0)));
+
+	for (int32 SlotIndex = 0; SlotIndex < NumRealizedSlots; ++SlotIndex)
+	{
+		Children.Add(SNew(SBox));
+	}
+	RealizePages(true);
+}
+
+void SSwipeGrid::SetCurrentCell(FIntPoint InCell, bool bAnimate)
+{
+	InCell.X = FMath::Clamp(InCell.X, 0, FMath::Max(NumColumns - 1, 0));
+	InCell.Y = FMath::Clamp(InCell.Y, 0, FMath::Max(NumRows - 1, 0));
+
+	const FIntPoint FinishedStep = PageDrag.FinishPageChange(LastPageSize);
+	if (FinishedStep != FIntPoint::ZeroValue)
+	{
+		StepBy(FinishedStep);
+	}
+
+	const FIntPoint Delta = InCell - CurrentCell;
+	if (Delta == FIntPoint::ZeroValue)
+	{
+		if (!PageDrag.GetOffset().IsZero())
+		{
+			PageDrag.AnimateTo(FVector2f::ZeroVector);
+		}
+		return;
+	}
+
+	const bool bNeighbour = FMath::Abs(Delta.X) + FMath::Abs(Delta.Y) == 1;
+	if (bAnimate && bNeighbour && LastPageSize.X > 0.f && LastPageSize.Y > 0.f)
+	{
+		PageDrag.AnimateTo(FVector2f(-Delta.X * LastPageSize.X, -Delta.Y * LastPageSize.Y));
+		return;
+	}
+
+	PageDrag.StopAnimation();
+	CurrentCell = InCell;
+	RealizePages(false);
+	PageDrag.SetOffset(FVector2f::ZeroVector);
+	Invalidate(EInvalidateWidgetReason::Layout);
+	OnPageChanged.ExecuteIfBound(CurrentCell);
+}
+
+void SSwipeGrid::SetGridSize(int32 InNumColumns, int32 InNumRows)
+{
+	InNumColumns = FMath::Max(InNumColumns, 0);
+	InNumRows = FMath::Max(InNumRows, 0);
+	if (NumColumns == InNumColumns && NumRows == InNumRows)
+	{
+		return;
+	}
+
+	NumColumns = InNumColumns;
+	NumRows = InNumRows;
+
+	const FIntPoint PreviousCell = CurrentCell;
+	CurrentCell.X = FMath::Clamp(CurrentCell.X, 0, FMath::Max(NumColumns - 1, 0));
+	CurrentCell.Y = FMath::Clamp(CurrentCell.Y, 0, FMath::Max(NumRows - 1, 0));
+
+	PageDrag.StopAnimation();
+	RealizePages(false);
+	PageDrag.SetOffset(FVector2f::ZeroVector);
+	Invalidate(EInvalidateWidgetReason::Layout);
+
+	if (CurrentCell != PreviousCell)
+	{
+		OnPageChanged.ExecuteIfBound(CurrentCell);
+	}
+}
+
+void SSwipeGrid::RefreshPages()
+{
+	RealizePages(true);
+}
+
+void SSwipeGrid::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+{
+	const FVector2f Size = AllottedGeometry.GetLocalSize();
+
+	for (int32 SlotIndex = 0; SlotIndex < NumRealizedSlots; ++SlotIndex)
+	{
+		const FIntPoint& Cell = RealizedPages[SlotIndex].Cell;
+		if (!IsValidCell(Cell))
+		{
+			continue;
+		}
+
+		const FVector2f Position = FVector2f(Cell.X - CurrentCell.X, Cell.Y - CurrentCell.Y) * Size + PageDrag.GetOffset();
+		if (Cell != CurrentCell && !FSwipePageDrag::IsPageInView(Position, Size))
+		{
+			continue;
+		}
+
+		const TSharedRef<SBox>& Page = Children[SlotIndex];
+		if (ArrangedChildren.Accepts(Page->GetVisibility()))
+		{
+			ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(Page, Size, FSlateLayoutTransform(Position)));
+		}
+	}
+}
+
+FChildren* SSwipeGrid::GetChildren()
+{
+	return &Children;
+}
+
+void SSwipeGrid::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	LastPageSize = AllottedGeometry.GetLocalSize();
+
+	const FIntPoint Step = PageDrag.TickAnimation(InDeltaTime);
+	if (Step != FIntPoint::ZeroValue)
+	{
+		StepBy(Step);
+	}
+}
+
+FReply SSwipeGrid::OnPreviewMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	PageDrag.OnPreviewTouchStarted(MouseEvent);
+	return FReply::Unhandled();
+}
+
+FReply SSwipeGrid::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	return MouseEvent.IsTouchEvent() ? FReply::Handled() : FReply::Unhandled();
+}
+
+FReply SSwipeGrid::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	using namespace SwipeGridPrivate;
+
+	if (TOptional<FReply> Reply = PageDrag.OnTouchMoved(MouseEvent))
+	{
+		return Reply.GetValue();
+	}
+
+	const FVector2f CursorDelta = MouseEvent.GetCursorDelta();
+	const FVector2f& Offset = PageDrag.GetOffset();
+	const bool bHorizontal = PageDrag.GetDragAxis() == Orient_Horizontal;
+	const float PageExtent = bHorizontal ? LastPageSize.X : LastPageSize.Y;
+	const float CurrentOffset = bHorizontal ? Offset.X : Offset.Y;
+	const float SwipeAmount = (bHorizontal ? CursorDelta.X : CursorDelta.Y) / MyGeometry.Scale;
+
+	float NewOffset = CurrentOffset + SwipeAmount;
+
+	// There is no page past the edges of the grid, resist the drag there instead of revealing empty space.
+	const int32 IncomingDirection = NewOffset > 0.f ? -1 : 1;
+	const FIntPoint IncomingCell = CurrentCell + (bHorizontal
+		                                              ? FIntPoint(IncomingDirection, 0)
+		                                              : FIntPoint(0, IncomingDirection));
+	if (!IsValidCell(IncomingCell))
+	{
+		const float MaxOverswipe = PageExtent * MaxEdgeOverswipe;
+		NewOffset = FMath::Clamp(CurrentOffset + SwipeAmount * EdgeResistance, -MaxOverswipe, MaxOverswipe);
+	}
+	NewOffset = FMath::Clamp(NewOffset, -PageExtent, PageExtent);
+
+	PageDrag.SetOffset(bHorizontal ? FVector2f(NewOffset, 0.f) : FVector2f(0.f, NewOffset));
+
+	return FReply::Handled();
+}
+
+FReply SSwipeGrid::OnTouchEnded(const FGeometry& MyGeometry, const FPointerEvent& InTouchEvent)
+{
+	return PageDrag.OnTouchEnded(InTouchEvent, [this](EOrientation InAxis)
+	{
+		OnDragReleased(InAxis);
+	});
+}
+
+void SSwipeGrid::OnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent)
+{
+	SPanel::OnMouseCaptureLost(CaptureLostEvent);
+
+	PageDrag.OnMouseCaptureLost([this](EOrientation InAxis)
+	{
+		OnDragReleased(InAxis);
+	});
+}
+
+FVector2D SSwipeGrid::ComputeDesiredSize(float) const
+{
+	FVector2D DesiredSize = FVector2D::ZeroVector;
+	for (int32 SlotIndex = 0; SlotIndex < NumRealizedSlots; ++SlotIndex)
+	{
+		if (IsValidCell(RealizedPages[SlotIndex].Cell))
+		{
+			DesiredSize = FVector2D::Max(DesiredSize, FVector2D(Children[SlotIndex]->GetDesiredSize()));
+		}
+	}
+	return DesiredSize;
+}
+
+void SSwipeGrid::RealizePages(bool bForce)
+{
+	TArray<FIntPoint, TInlineAllocator<NumRealizedSlots>> MissingCells;
+	for (int32 RowOffset = -RealizeRadius; RowOffset <= RealizeRadius; ++RowOffset)
+	{
+		for (int32 ColumnOffset = -RealizeRadius; ColumnOffset <= RealizeRadius; ++ColumnOffset)
+		{
+			const FIntPoint Cell = CurrentCell + FIntPoint(ColumnOffset, RowOffset);
+			if (IsValidCell(Cell))
+			{
+				MissingCells.Add(Cell);
+			}
+		}
+	}
+
+	// Slots already showing a page that is still near the viewport keep it, the others are recycled.
+	TArray<int32, TInlineAllocator<NumRealizedSlots>> FreeSlots;
+	for (int32 SlotIndex = 0; SlotIndex < NumRealizedSlots; ++SlotIndex)
+	{
+		const FIntPoint Cell = RealizedPages[SlotIndex].Cell;
+		if (IsValidCell(Cell) && MissingCells.Remove(Cell) > 0)
+		{
+			if (bForce)
+			{
+				BindSlot(SlotIndex, Cell);
+			}
+		}
+		else
+		{
+			FreeSlots.Add(SlotIndex);
+		}
+	}
+
+	for (int32 FreeIndex = 0; FreeIndex < FreeSlots.Num(); ++FreeIndex)
+	{
+		BindSlot(FreeSlots[FreeIndex],
+		         MissingCells.IsValidIndex(FreeIndex) ? MissingCells[FreeIndex] : FIntPoint(INDEX_NONE, INDEX_NONE));
+	}
+
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
+
+void SSwipeGrid::BindSlot(int32 InSlotIndex, const FIntPoint& InCell)
+{
+	FRealizedPage& Page = RealizedPages[InSlotIndex];
+	Page.Cell = InCell;
+
+	// An unused slot keeps its content so the next page bound to it can recycle the widget.
+	if (!IsValidCell(InCell) || !OnGeneratePage.IsBound())
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	const TSharedRef<SWidget> Content = OnGeneratePage.Execute(InCell, Page.Content);
+	if (Content != Page.Content)
+	{
+		Page.Content = Content;
+		Children[InSlotIndex]->SetContent(Content);
+	}
+}
+
+void SSwipeGrid::StepBy(const FIntPoint& InStep)
+{
+	CurrentCell += InStep;
+	RealizePages(false);
+	OnPageChanged.ExecuteIfBound(CurrentCell);
+}
+
+void SSwipeGrid::OnDragReleased(EOrientation InAxis)
+{
+	const bool bHorizontal = InAxis == Orient_Horizontal;
+	const float PageExtent = bHorizontal ? LastPageSize.X : LastPageSize.Y;
+	const float CurrentOffset = bHorizontal ? PageDrag.GetOffset().X : PageDrag.GetOffset().Y;
+	const float Threshold = PageExtent * ScreenPercentValidation;
+
+	const int32 Direction = CurrentOffset < -Threshold ? 1 : CurrentOffset > Threshold ? -1 : 0;
+	const FIntPoint Step = bHorizontal ? FIntPoint(Direction, 0) : FIntPoint(0, Direction);
+
+	if (Direction != 0 && IsValidCell(CurrentCell + Step))
+	{
+		PageDrag.AnimateTo(FVector2f(-Step.X * LastPageSize.X, -Step.Y * LastPageSize.Y));
+	}
+	else
+	{
+		PageDrag.AnimateTo(FVector2f::ZeroVector);
+	}
+}
@@ -0,0 +1,279 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Slate/Widgets/Layout/SSwipePageIndicator.h"
+
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "WidgetSwipeStyle.h"
+
+SSwipePageIndicator::SSwipePageIndicator()
+	: NumPages(0)
+	  , PagePosition(0.f)
+	  , Orientation(Orient_Horizontal)
+	  , DotBrush(nullptr)
+	  , DotSize(8.f, 8.f)
+	  , DotSpacing(8.f)
+	  , MaxVisibleDots(9)
+{
+}
+
+void SSwipePageIndicator::Construct(const FArguments& InArgs)
+{
+	NumPages = FMath::Max(InArgs._NumPages, 0);
+	PagePosition = InArgs._PagePosition;
+	Orientation = InArgs._Orientation;
+	DotBrush = InArgs._DotBrush;
+	DotSize = InArgs._DotSize;
+	DotSpacing = InArgs._DotSpacing;
+	MaxVisibleDots = FMath::Max(InArgs._MaxVisibleDots, 1);
+	DotColor = InArgs._DotColor;
+	ActiveDotColor = InArgs._ActiveDotColor;
+	OnPageClicked = InArgs._OnPageClicked;
+}
+
+void SSwipePageIndicator::SetNumPages(int32 InNumPages)
+{
+	InNumPages = FMath::Max(InNumPages, 0);
+	if (NumPages != InNumPages)
+	{
+		// The window only changes size while there are fewer pages than visible dots.
+		const bool bSizeChanged = GetNumVisibleDots() != FMath::Min(InNumPages, MaxVisibleDots);
+		NumPages = InNumPages;
+		Invalidate(bSizeChanged ? EInvalidateWidgetReason::Layout : EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SSwipePageIndicator::SetPagePosition(float InPagePosition)
+{
+	if (PagePosition != InPagePosition)
+	{
+		PagePosition = InPagePosition;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SSwipePageIndicator::SetOrientation(EOrientation InOrientation)
+{
+	if (Orientation != InOrientation)
+	{
+		Orientation = InOrientation;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SSwipePageIndicator::SetDotBrush(const FSlateBrush* InDotBrush)
+{
+	// Repaints even for the same pointer, the owner may have changed the brush behind it.
+	DotBrush = InDotBrush;
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SSwipePageIndicator::SetDotSize(FVector2f InDotSize)
+{
+	if (DotSize != InDotSize)
+	{
+		DotSize = InDotSize;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SSwipePageIndicator::SetDotSpacing(float InDotSpacing)
+{
+	if (DotSpacing != InDotSpacing)
+	{
+		DotSpacing = InDotSpacing;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SSwipePageIndicator::SetMaxVisibleDots(int32 InMaxVisibleDots)
+{
+	InMaxVisibleDots = FMath::Max(InMaxVisibleDots, 1);
+	if (MaxVisibleDots != InMaxVisibleDots)
+	{
+		MaxVisibleDots = InMaxVisibleDots;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SSwipePageIndicator::SetDotColor(const FSlateColor& InDotColor)
+{
+	if (DotColor != InDotColor)
+	{
+		DotColor = InDotColor;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SSwipePageIndicator::SetActiveDotColor(const FSlateColor& InActiveDotColor)
+{
+	if (ActiveDotColor != InActiveDotColor)
+	{
+		ActiveDotColor = InActiveDotColor;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+int32 SSwipePageIndicator::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
+                                   const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements,
+                                   int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const int32 NumVisibleDots = GetNumVisibleDots();
+	const FSlateBrush* Brush = GetDotBrush();
+	if (NumVisibleDots <= 0 || !Brush || Brush->DrawAs == ESlateBrushDrawType::NoDrawType)
+	{
+		return LayerId;
+	}
+
+	const ESlateDrawEffect DrawEffect = ShouldBeEnabled(bParentEnabled)
+		                                    ? ESlateDrawEffect::None
+		                                    : ESlateDrawEffect::DisabledEffect;
+	const FLinearColor Tint = Brush->GetTint(InWidgetStyle) * InWidgetStyle.GetColorAndOpacityTint();
+	const FLinearColor InactiveColor = DotColor.GetColor(InWidgetStyle) * Tint;
+	const FLinearColor ActiveColor = ActiveDotColor.GetColor(InWidgetStyle) * Tint;
+
+	const bool bHorizontal = Orientation == Orient_Horizontal;
+	const FVector2f LocalSize = AllottedGeometry.GetLocalSize();
+	const float DotAlong = bHorizontal ? DotSize.X : DotSize.Y;
+	const float Step = DotAlong + DotSpacing;
+	const float DotsLength = NumVisibleDots * DotAlong + (NumVisibleDots - 1) * DotSpacing;
+	const float Start = ((bHorizontal ? LocalSize.X : LocalSize.Y) - DotsLength) * 0.5f;
+
+	// In a window, the dots at an edge shrink when pages continue past it, fully so once the window moved a page.
+	const float WindowStart = GetWindowStart();
+	const float LastSlot = NumVisibleDots - 1.f;
+	const float ShrinkBefore = FMath::Clamp(WindowStart, 0.f, 1.f);
+	const float ShrinkAfter = FMath::Clamp(NumPages - NumVisibleDots - WindowStart, 0.f, 1.f);
+
+	const int32 FirstPage = FMath::FloorToInt32(WindowStart);
+	const int32 LastPage = FMath::Min(FMath::CeilToInt32(WindowStart + LastSlot), NumPages - 1);
+	for (int32 Page = FirstPage; Page <= LastPage; ++Page)
+	{
+		const float Slot = Page - WindowStart;
+
+		float Scale = 1.f;
+		if (NumPages > NumVisibleDots)
+		{
+			// Half size on the edge slot, nothing one slot past it.
+			const float DistanceToEdge = FMath::Min(Slot, LastSlot - Slot);
+			const float EdgeScale = FMath::Clamp(0.5f + 0.5f * DistanceToEdge, 0.f, 1.f);
+			Scale = FMath::Lerp(1.f, EdgeScale, Slot * 2.f < LastSlot ? ShrinkBefore : ShrinkAfter);
+		}
+		if (Scale <= 0.f)
+		{
+			continue;
+		}
+
+		const float Activation = FMath::Max(1.f - FMath::Abs(Page - PagePosition), 0.f);
+		const FVector2f Size = DotSize * Scale;
+		const float Along = Start + Slot * Step + (DotAlong - (bHorizontal ? Size.X : Size.Y)) * 0.5f;
+		const FVector2f Position = bHorizontal
+			                           ? FVector2f(Along, (LocalSize.Y - Size.Y) * 0.5f)
+			                           : FVector2f((LocalSize.X - Size.X) * 0.5f, Along);
+
+		// Every dot shares the layer and the brush, the renderer batches them into a single draw.
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+		                           AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(Position)), Brush,
+		                           DrawEffect, FMath::Lerp(InactiveColor, ActiveColor, Activation));
+	}
+
+	return LayerId;
+}
+
+FReply SSwipePageIndicator::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (OnPageClicked.IsBound() && NumPages > 0
+		&& (MouseEvent.IsTouchEvent() || MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton))
+	{
+		PressedPointerIndex = MouseEvent.GetPointerIndex();
+		return FReply::Handled().CaptureMouse(AsShared());
+	}
+	return FReply::Unhandled();
+}
+
+FReply SSwipePageIndicator::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!PressedPointerIndex.IsSet() || PressedPointerIndex.GetValue() != MouseEvent.GetPointerIndex())
+	{
+		return FReply::Unhandled();
+	}
+	PressedPointerIndex.Reset();
+
+	// Released outside, the user changed their mind.
+	if (MyGeometry.IsUnderLocation(MouseEvent.GetScreenSpacePosition()))
+	{
+		const int32 Page = GetPageAtLocalPosition(MyGeometry, MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()));
+		if (Page != INDEX_NONE)
+		{
+			OnPageClicked.ExecuteIfBound(Page);
+		}
+	}
+	return FReply::Handled().ReleaseMouseCapture();
+}
+
+void SSwipePageIndicator::OnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent)
+{
+	SLeafWidget::OnMouseCaptureLost(CaptureLostEvent);
+	PressedPointerIndex.Reset();
+}
+
+FVector2D SSwipePageIndicator::ComputeDesiredSize(float) const
+{
+	const int32 NumVisibleDots = GetNumVisibleDots();
+	if (NumVisibleDots <= 0)
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	const float DotsLength = NumVisibleDots * (Orientation == Orient_Horizontal ? DotSize.X : DotSize.Y)
+		+ (NumVisibleDots - 1) * DotSpacing;
+	return Orientation == Orient_Horizontal
+		       ? FVector2D(DotsLength, DotSize.Y)
+		       : FVector2D(DotSize.X, DotsLength);
+}
+
+float SSwipePageIndicator::GetWindowStart() const
+{
+	const int32 NumVisibleDots = GetNumVisibleDots();
+	// Keeps the current page in the middle of the window, except near the first and last pages.
+	return FMath::Clamp(PagePosition - (NumVisibleDots - 1) * 0.5f, 0.f, static_cast<float>(NumPages - NumVisibleDots));
+}
+
+int32 SSwipePageIndicator::GetPageAtLocalPosition(const FGeometry& InGeometry, const FVector2f& InLocalPosition) const
+{
+	const int32 NumVisibleDots = GetNumVisibleDots();
+	if (NumVisibleDots <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const bool bHorizontal = Orientation == Orient_Horizontal;
+	const float DotAlong = bHorizontal ? DotSize.X : DotSize.Y;
+	const float Step = DotAlong + DotSpacing;
+	const float DotsLength = NumVisibleDots * DotAlong + (NumVisibleDots - 1) * DotSpacing;
+	const FVector2f LocalSize = InGeometry.GetLocalSize();
+	const float Start = ((bHorizontal ? LocalSize.X : LocalSize.Y) - DotsLength) * 0.5f;
+	const float Position = bHorizontal ? InLocalPosition.X : InLocalPosition.Y;
+	// A tap in the margin around the dots is not a tap on the first or last dot.
+	if (Position < Start || Position > Start + DotsLength)
+	{
+		return INDEX_NONE;
+	}
+	const float Along = Position - Start - DotAlong * 0.5f;
+
+	const int32 Page = FMath::RoundToInt32(GetWindowStart() + (Step > 0.f ? Along / Step : 0.f));
+	return FMath::Clamp(Page, 0, NumPages - 1);
+}
+
+const FSlateBrush* SSwipePageIndicator::GetDotBrush() const
+{
+	if (DotBrush)
+	{
+		return DotBrush;
+	}
+
+	const TSharedPtr<ISlateStyle> Style = FWidgetSwipeStyle::Get();
+	return Style.IsValid()
+		       ? Style->GetBrush("SwipePageIndicator.Dot")
+		       : FCoreStyle::Get().GetBrush("GenericWhiteBox");
+}
@@ -0,0 +1,214 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "UObject/UObjectIterator.h"
+#include "Blueprint/UserWidget.h"
+#include "Slate/Widgets/Layout/SSwipeBox.h"
+#include "UMG/Components/SwipeBox.h"
+#include "UMG/Components/SwipeBoxSlot.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace SwipeBoxConsoleCommands
+{
+	/** Rough memory figures gathered for one live swipe box. */
+	struct FSwipeBoxMemoryEntry
+	{
+		FString Name;
+		int32 NumSlots = 0;
+		int32 NumRealizedPages = 0;
+		int32 CurrentPage = 0;
+		int32 NumSubtreeWidgets = 0;
+		SIZE_T SlateBytes = 0;
+		SIZE_T StyleBytes = 0;
+		SIZE_T ContentObjectBytes = 0;
+	};
+
+	/**
+	 * Counts every widget below InWidget (included).
+	 * Slate has no per-widget size information, so the byte estimate multiplies this count by the
+	 * size of a compound widget; treat it as a lower bound that is stable between builds.
+	 */
+	int32 CountSubtreeWidgets(const SWidget& InWidget)
+	{
+		int32 Count = 1;
+		FChildren* Children = const_cast<SWidget&>(InWidget).GetChildren();
+		for (int32 ChildIndex = 0; ChildIndex < Children->Num(); ++ChildIndex)
+		{
+			Count += CountSubtreeWidgets(Children->GetChildAt(ChildIndex).Get());
+		}
+		return Count;
+	}
+
+	/** @return the UMG owner of the Slate swipe box, if the box was built by a USwipeBox. */
+	const USwipeBox* FindOwner(const SSwipeBox& InSwipeBox)
+	{
+		for (TObjectIterator<USwipeBox> It; It; ++It)
+		{
+			if (It->GetCachedWidget().Get() == &InSwipeBox)
+			{
+				return *It;
+			}
+		}
+		return nullptr;
+	}
+
+	SIZE_T GetContentObjectBytes(const USwipeBox& InOwner)
+	{
+		SIZE_T Bytes = 0;
+		for (int32 ChildIndex = 0; ChildIndex < InOwner.GetChildrenCount(); ++ChildIndex)
+		{
+			if (UWidget* Content = InOwner.GetChildAt(ChildIndex))
+			{
+				Bytes += Content->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+				const UUserWidget* UserWidget = Cast<UUserWidget>(Content);
+				if (UserWidget && UserWidget->WidgetTree)
+				{
+					UserWidget->WidgetTree->ForEachWidget([&Bytes](UWidget* Widget)
+					{
+						Bytes += Widget->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+					});
+				}
+			}
+		}
+		return Bytes;
+	}
+
+	TArray<FSwipeBoxMemoryEntry> GatherMemoryEntries()
+	{
+		TArray<FSwipeBoxMemoryEntry> Entries;
+		SSwipeBox::ForEachLiveInstance([&Entries](const SSwipeBox& SwipeBox)
+		{
+			FSwipeBoxMemoryEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.NumSlots = SwipeBox.GetNumSlots();
+			Entry.NumRealizedPages = SwipeBox.GetNumRealizedPages();
+			Entry.CurrentPage = SwipeBox.GetCurrentPage();
+			Entry.NumSubtreeWidgets = CountSubtreeWidgets(SwipeBox);
+			Entry.SlateBytes = sizeof(SSwipeBox)
+				+ Entry.NumSlots * sizeof(SSwipeBox::FSlot)
+				+ (Entry.NumSubtreeWidgets - 1) * sizeof(SCompoundWidget);
+
+			if (const USwipeBox* Owner = FindOwner(SwipeBox))
+			{
+				Entry.Name = Owner->GetPathName();
+				Entry.StyleBytes = sizeof(FSwipeBoxStyle) + sizeof(FSwipeBarStyle);
+				Entry.ContentObjectBytes = GetContentObjectBytes(*Owner);
+			}
+			else
+			{
+				Entry.Name = FString::Printf(TEXT("SSwipeBox 0x%p"), &SwipeBox);
+			}
+		});
+		return Entries;
+	}
+
+	FString MemoryEntriesToJson(const TArray<FSwipeBoxMemoryEntry>& InEntries)
+	{
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("SizeofSwipeBoxStyle"), static_cast<int64>(sizeof(FSwipeBoxStyle)));
+		Writer->WriteValue(TEXT("SizeofSwipeBarStyle"), static_cast<int64>(sizeof(FSwipeBarStyle)));
+		Writer->WriteArrayStart(TEXT("SwipeBoxes"));
+		for (const FSwipeBoxMemoryEntry& Entry : InEntries)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("Name"), Entry.Name);
+			Writer->WriteValue(TEXT("NumSlots"), Entry.NumSlots);
+			Writer->WriteValue(TEXT("NumRealizedPages"), Entry.NumRealizedPages);
+			Writer->WriteValue(TEXT("CurrentPage"), Entry.CurrentPage);
+			Writer->WriteValue(TEXT("NumSubtreeWidgets"), Entry.NumSubtreeWidgets);
+			Writer->WriteValue(TEXT("EstimatedSlateBytes"), static_cast<int64>(Entry.SlateBytes));
+			Writer->WriteValue(TEXT("StyleBytes"), static_cast<int64>(Entry.StyleBytes));
+			Writer->WriteValue(TEXT("EstimatedContentObjectBytes"), static_cast<int64>(Entry.ContentObjectBytes));
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+		return Json;
+	}
+
+	/**
+	 * SwipeBox.MemReport [-json] [-file]
+	 * Lists every live swipe box. -json prints the report as JSON, -file also saves it under Saved/Profiling/SwipeBox.
+	 */
+	void MemReport(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const bool bJson = Args.Contains(TEXT("-json"));
+		const bool bFile = Args.Contains(TEXT("-file"));
+		const TArray<FSwipeBoxMemoryEntry> Entries = GatherMemoryEntries();
+
+		if (bJson || bFile)
+		{
+			const FString Json = MemoryEntriesToJson(Entries);
+			if (bFile)
+			{
+				const FString FileName = FPaths::ProfilingDir() / TEXT("SwipeBox") / FString::Printf(TEXT("MemReport-%s.json"), *FDateTime::Now().ToString());
+				if (FFileHelper::SaveStringToFile(Json, *FileName))
+				{
+					Ar.Logf(TEXT("SwipeBox memory report saved to %s"), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*FileName));
+				}
+			}
+			if (bJson)
+			{
+				Ar.Log(Json);
+			}
+			return;
+		}
+
+		SIZE_T TotalBytes = 0;
+		Ar.Logf(TEXT("%d live SSwipeBox (FSwipeBoxStyle: %d bytes, FSwipeBarStyle: %d bytes)"), Entries.Num(), static_cast<int32>(sizeof(FSwipeBoxStyle)), static_cast<int32>(sizeof(FSwipeBarStyle)));
+		for (const FSwipeBoxMemoryEntry& Entry : Entries)
+		{
+			const SIZE_T EntryBytes = Entry.SlateBytes + Entry.StyleBytes + Entry.ContentObjectBytes;
+			TotalBytes += EntryBytes;
+			Ar.Logf(TEXT("  %s: %d slots, %d realized, page %d, %d widgets, ~%.1f KB (slate %.1f KB, style %.1f KB, content %.1f KB)"),
+				*Entry.Name, Entry.NumSlots, Entry.NumRealizedPages, Entry.CurrentPage, Entry.NumSubtreeWidgets,
+				EntryBytes / 1024.0, Entry.SlateBytes / 1024.0, Entry.StyleBytes / 1024.0, Entry.ContentObjectBytes / 1024.0);
+		}
+		Ar.Logf(TEXT("Total ~%.1f KB"), TotalBytes / 1024.0);
+	}
+
+	FAutoConsoleCommandWithArgsAndOutputDevice MemReportCommand(
+		TEXT("SwipeBox.MemReport"),
+		TEXT("Lists every live swipe box with slot counts, style sizes and an estimated memory footprint. Options: -json, -file"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&MemReport));
+
+	/**
+	 * SwipeBox.InputLatency [reset]
+	 * Prints the touch move to arrange latency percentiles of every live swipe box, or clears them.
+	 */
+	void InputLatency(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const bool bReset = Args.Contains(TEXT("reset"));
+		SSwipeBox::ForEachLiveInstance([bReset, &Ar](SSwipeBox& SwipeBox)
+		{
+			const USwipeBox* Owner = FindOwner(SwipeBox);
+			const FString Name = Owner ? Owner->GetPathName() : FString::Printf(TEXT("SSwipeBox 0x%p"), &SwipeBox);
+			if (bReset)
+			{
+				SwipeBox.ResetInputLatency();
+				Ar.Logf(TEXT("  %s: reset"), *Name);
+				return;
+			}
+
+			const FSwipeLatencyHistogram& Histogram = SwipeBox.GetInputLatency();
+			Ar.Logf(TEXT("  %s: %u samples, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms"), *Name, Histogram.GetNumSamples(),
+				Histogram.GetPercentileMs(50.f), Histogram.GetPercentileMs(95.f), Histogram.GetPercentileMs(99.f));
+		});
+	}
+
+	FAutoConsoleCommandWithArgsAndOutputDevice InputLatencyCommand(
+		TEXT("SwipeBox.InputLatency"),
+		TEXT("Prints the delay between touch moves and the layout pass applying them for every live swipe box. Options: reset"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&InputLatency));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -3,7 +3,14 @@
 #include "UMG/Components/SwipeBox.h"
 
 #include "WidgetSwipeStyle.h"
+#include "MobileWidgetSwipeStats.h"
+#include "Animation/WidgetAnimation.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
 #include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/GCObject.h"
 #include "Slate/Styling/DefaultStyleCacheExtension.h"
 #include "UMG/Components/SwipeBoxSlot.h"
 #include "UObject/EditorObjectVersion.h"
@@ -14,6 +21,99 @@
 
 #define LOCTEXT_NAMESPACE "UMG"
 
+namespace SwipeBoxPrivate
+{
+	/**
+	 * Contents of the pages removed from time slicing swipe boxes, whose Slate resources are released a few per
+	 * frame. Shared by every box and keeping the contents alive, so it outlives the box that queued them.
+	 */
+	class FPageTeardownQueue : public FGCObject
+	{
+	public:
+		static void Enqueue(UWidget* InContent, float InBudgetMs)
+		{
+			if (!Instance.IsValid())
+			{
+				Instance = MakeUnique<FPageTeardownQueue>();
+			}
+			// The tightest budget of the boxes with pages queued, a box with a loose one must not eat into the frame of
+			// another.
+			Instance->BudgetMs = Instance->Contents.Num() > 0 ? FMath::Min(Instance->BudgetMs, InBudgetMs) : InBudgetMs;
+			Instance->Contents.Add(InContent);
+			if (!Instance->TickHandle.IsValid())
+			{
+				Instance->TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+					FTickerDelegate::CreateRaw(Instance.Get(), &FPageTeardownQueue::Tick));
+			}
+		}
+
+		static void Flush()
+		{
+			if (Instance.IsValid())
+			{
+				FTSTicker::GetCoreTicker().RemoveTicker(Instance->TickHandle);
+				while (Instance->Contents.Num() > 0)
+				{
+					Instance->ReleaseNext();
+				}
+				Instance.Reset();
+			}
+		}
+
+		//~ Begin FGCObject Interface
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			Collector.AddReferencedObjects(Contents);
+		}
+
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("SwipeBoxPrivate::FPageTeardownQueue");
+		}
+		//~ End FGCObject Interface
+
+	private:
+		bool Tick(float)
+		{
+			LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+			TRACE_CPUPROFILER_EVENT_SCOPE(SwipeBoxPrivate::FPageTeardownQueue::Tick);
+
+			// At least one page per frame, a page costing more than the budget would never be released otherwise.
+			const double EndTime = FPlatformTime::Seconds() + BudgetMs / 1000.0;
+			do
+			{
+				ReleaseNext();
+			}
+			while (Contents.Num() > 0 && FPlatformTime::Seconds() < EndTime);
+
+			if (Contents.Num() == 0)
+			{
+				TickHandle.Reset();
+				return false;
+			}
+			return true;
+		}
+
+		void ReleaseNext()
+		{
+			const TObjectPtr<UWidget> Content = Contents.Pop(false);
+			// A content added to a panel or the viewport since its page was removed is in use again.
+			if (Content && !Content->Slot && !Content->IsInViewport())
+			{
+				Content->ReleaseSlateResources(true);
+			}
+		}
+
+		static TUniquePtr<FPageTeardownQueue> Instance;
+
+		TArray<TObjectPtr<UWidget>> Contents;
+		float BudgetMs = 2.f;
+		FTSTicker::FDelegateHandle TickHandle;
+	};
+
+	TUniquePtr<FPageTeardownQueue> FPageTeardownQueue::Instance;
+}
+
 /////////////////////////////////////////////////////
 // USwipeBox
 
@@ -44,11 +144,10 @@ USwipeBox::USwipeBox(const FObjectInitializer& ObjectInitializer)
 
 	SetVisibilityInternal(ESlateVisibility::Visible);
 	SetClipping(EWidgetClipping::ClipToBounds);
+	// The default style is built without the style set, so the class default object made when the module loads does
+	// not register it.
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	if (FWidgetSwipeStyle::Get())
-	{
-		WidgetStyle = FWidgetSwipeStyle::Get()->GetWidgetStyle<FSwipeBoxStyle>("SwipeBox");
-	}
+	WidgetStyle = FWidgetSwipeStyle::GetDefaultSwipeBoxStyle();
 	// WidgetStyle = UE::Slate::Private::FDefaultStyleCacheExtension::GetRuntime().GetSwipeBoxStyle();
 	WidgetBarStyle = UE::Slate::Private::FDefaultStyleCacheExtension::GetRuntime().GetSwipeBarStyle();
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -57,10 +156,7 @@ USwipeBox::USwipeBox(const FObjectInitializer& ObjectInitializer)
 	if (IsEditorWidget())
 	{
 		PRAGMA_DISABLE_DEPRECATION_WARNINGS
-		if (FWidgetSwipeStyle::Get())
-		{
-			WidgetStyle = FWidgetSwipeStyle::Get()->GetWidgetStyle<FSwipeBoxStyle>("SwipeBox");
-		}
+		WidgetStyle = FWidgetSwipeStyle::GetDefaultSwipeBoxStyle();
 		// WidgetStyle = UE::Slate::Private::FDefaultStyleCacheExtension::GetEditor().GetSwipeBoxStyle();
 		WidgetBarStyle = UE::Slate::Private::FDefaultStyleCacheExtension::GetEditor().GetSwipeBarStyle();
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -78,7 +174,24 @@ void USwipeBox::ReleaseSlateResources(bool bReleaseChildren)
 {
 	Super::ReleaseSlateResources(bReleaseChildren);
 
+	ReleasePageStreaming();
+	ResumePageAnimations();
+	if (PageBuildTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PageBuildTickHandle);
+		PageBuildTickHandle.Reset();
+	}
 	MySwipeBox.Reset();
+	SyncedProperties.Reset();
+
+#if WITH_EDITOR
+	// The pending designer ticker captures this widget, do not let it outlive the Slate resources.
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+#endif
 }
 
 UClass* USwipeBox::GetSlotClass() const
@@ -88,28 +201,219 @@ UClass* USwipeBox::GetSlotClass() const
 
 void USwipeBox::OnSlotAdded(UPanelSlot* InSlot)
 {
+	if (bDeferSlateSlotUpdates)
+	{
+		DeferredAddedSlots.Add(CastChecked<USwipeBoxSlot>(InSlot));
+		return;
+	}
+
 	// Add the child to the live canvas if it already exists
 	if (MySwipeBox.IsValid())
 	{
-		CastChecked<USwipeBoxSlot>(InSlot)->BuildSlot(MySwipeBox.ToSharedRef());
+		MySwipeBox->AddSlot(MakePageSlotArguments(CastChecked<USwipeBoxSlot>(InSlot)));
+		SchedulePageBuild();
+		UpdatePageStreaming();
 	}
 }
 
 void USwipeBox::OnSlotRemoved(UPanelSlot* InSlot)
 {
-	// Remove the widget from the live slot if it exists.
+	USwipeBoxSlot* TypedSlot = Cast<USwipeBoxSlot>(InSlot);
+
+	// Remove the widget from the live slot if it exists, a page not built yet still holds its placeholder.
 	if (MySwipeBox.IsValid() && InSlot->Content)
 	{
-		const TSharedPtr<SWidget> Widget = InSlot->Content->GetCachedWidget();
+		const TSharedPtr<SWidget> Widget = TypedSlot ? TypedSlot->GetSlotWidget() : InSlot->Content->GetCachedWidget();
 		if (Widget.IsValid())
 		{
-			MySwipeBox->RemoveSlot(Widget.ToSharedRef());
+			if (bDeferSlateSlotUpdates)
+			{
+				DeferredRemovedWidgets.Add(Widget.ToSharedRef());
+			}
+			else
+			{
+				MySwipeBox->RemoveSlot(Widget.ToSharedRef());
+			}
+		}
+	}
+	DeferredAddedSlots.RemoveSingle(TypedSlot);
+
+	if (TypedSlot)
+	{
+		TypedSlot->ReleaseStreamedAssets();
+
+		// The panel releases the Slate resources of the slot right after, leave those of a built page to the queue.
+		if (MySwipeBox.IsValid() && InSlot->Content && TypedSlot->IsContentBuilt() && ShouldTimeSlicePageBuild())
+		{
+			TypedSlot->DeferContentRelease();
+			SwipeBoxPrivate::FPageTeardownQueue::Enqueue(InSlot->Content, PageBuildBudgetMs);
+		}
+	}
+	// A removed page no longer gets lifecycle events, do not leave its animations paused.
+	SetPageAnimationsPaused(InSlot->Content, false);
+}
+
+TArray<USwipeBoxSlot*> USwipeBox::AddChildren(const TArray<UWidget*>& Contents)
+{
+	TArray<USwipeBoxSlot*> NewSlots = AddChildrenDeferred(Contents);
+	FlushDeferredSlateSlotUpdates(false);
+	return NewSlots;
+}
+
+int32 USwipeBox::RemoveChildren(const TArray<UWidget*>& Contents)
+{
+	int32 NumRemoved = 0;
+	{
+		TGuardValue<bool> DeferGuard(bDeferSlateSlotUpdates, true);
+		for (UWidget* Content : Contents)
+		{
+			NumRemoved += RemoveChild(Content) ? 1 : 0;
+		}
+	}
+	FlushDeferredSlateSlotUpdates(false);
+	return NumRemoved;
+}
+
+TArray<USwipeBoxSlot*> USwipeBox::ReplaceChildren(const TArray<UWidget*>& Contents)
+{
+	{
+		TGuardValue<bool> DeferGuard(bDeferSlateSlotUpdates, true);
+		ClearChildren();
+	}
+	TArray<USwipeBoxSlot*> NewSlots = AddChildrenDeferred(Contents);
+	FlushDeferredSlateSlotUpdates(true);
+	return NewSlots;
+}
+
+void USwipeBox::SyncChildren(const TArray<FName>& Keys, const TArray<UWidget*>& Contents)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+
+	if (Keys.Num() != Contents.Num() || Contents.Contains(nullptr) || TSet<UWidget*>(Contents).Num() != Contents.Num())
+	{
+		UE_LOG(LogSlate, Warning, TEXT("SyncChildren on '%s' expects one unique, non null, content per key."), *GetName());
+		return;
+	}
+
+	TMap<FName, UWidget*> ContentByKey;
+	ContentByKey.Reserve(Keys.Num());
+	for (int32 Index = 0; Index < Keys.Num(); ++Index)
+	{
+		if (Keys[Index].IsNone() || ContentByKey.Contains(Keys[Index]))
+		{
+			UE_LOG(LogSlate, Warning, TEXT("SyncChildren on '%s' expects unique keys that are not None."), *GetName());
+			return;
+		}
+		ContentByKey.Add(Keys[Index], Contents[Index]);
+	}
+
+	TMap<FName, USwipeBoxSlot*> SlotByKey;
+	SlotByKey.Reserve(Keys.Num());
+	{
+		TGuardValue<bool> DeferGuard(bDeferSlateSlotUpdates, true);
+
+		// Keep the slots whose key still maps to the same content, the others are rebuilt.
+		for (int32 SlotIndex = Slots.Num() - 1; SlotIndex >= 0; --SlotIndex)
+		{
+			USwipeBoxSlot* TypedSlot = Cast<USwipeBoxSlot>(Slots[SlotIndex]);
+			UWidget* const* WantedContent = TypedSlot ? ContentByKey.Find(TypedSlot->GetKey()) : nullptr;
+			if (WantedContent && *WantedContent == TypedSlot->Content)
+			{
+				SlotByKey.Add(TypedSlot->GetKey(), TypedSlot);
+			}
+			else
+			{
+				RemoveChildAt(SlotIndex);
+			}
+		}
+
+		for (int32 Index = 0; Index < Keys.Num(); ++Index)
+		{
+			if (!SlotByKey.Contains(Keys[Index]))
+			{
+				USwipeBoxSlot* NewSlot = CastChecked<USwipeBoxSlot>(AddChild(Contents[Index]));
+				NewSlot->SetKey(Keys[Index]);
+				SlotByKey.Add(Keys[Index], NewSlot);
+			}
+		}
+
+		// Every slot now exists, put them in the order of the keys.
+		Slots.Reset();
+		for (const FName& Key : Keys)
+		{
+			Slots.Add(SlotByKey[Key]);
 		}
 	}
+
+	if (MySwipeBox.IsValid())
+	{
+		MySwipeBox->RemoveSlots(DeferredRemovedWidgets);
+
+		MySwipeBox->SyncSlots(Keys, [this, &SlotByKey](FName InKey, int32)
+		{
+			return MakePageSlotArguments(SlotByKey[InKey]);
+		});
+		SchedulePageBuild();
+	}
+
+	DeferredAddedSlots.Reset();
+	DeferredRemovedWidgets.Reset();
+	InvalidateLayoutAndVolatility();
+	UpdatePageStreaming();
+}
+
+TArray<USwipeBoxSlot*> USwipeBox::AddChildrenDeferred(const TArray<UWidget*>& Contents)
+{
+	TGuardValue<bool> DeferGuard(bDeferSlateSlotUpdates, true);
+
+	TArray<USwipeBoxSlot*> NewSlots;
+	NewSlots.Reserve(Contents.Num());
+	Slots.Reserve(Slots.Num() + Contents.Num());
+	for (UWidget* Content : Contents)
+	{
+		if (USwipeBoxSlot* NewSlot = Cast<USwipeBoxSlot>(AddChild(Content)))
+		{
+			NewSlots.Add(NewSlot);
+		}
+	}
+	return NewSlots;
+}
+
+void USwipeBox::FlushDeferredSlateSlotUpdates(bool bReplaceAll)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+
+	if (MySwipeBox.IsValid())
+	{
+		// The Slate widget is only invalidated by the bulk calls below.
+		TArray<SSwipeBox::FSlot::FSlotArguments> SlotArguments;
+		SlotArguments.Reserve(DeferredAddedSlots.Num());
+		for (USwipeBoxSlot* AddedSlot : DeferredAddedSlots)
+		{
+			SlotArguments.Add(MakePageSlotArguments(AddedSlot));
+		}
+
+		if (bReplaceAll)
+		{
+			MySwipeBox->ReplaceSlots(MoveTemp(SlotArguments));
+		}
+		else
+		{
+			MySwipeBox->RemoveSlots(DeferredRemovedWidgets);
+			MySwipeBox->AddSlots(MoveTemp(SlotArguments));
+		}
+		SchedulePageBuild();
+	}
+
+	DeferredAddedSlots.Reset();
+	DeferredRemovedWidgets.Reset();
+	UpdatePageStreaming();
 }
 
 TSharedRef<SWidget> USwipeBox::RebuildWidget()
 {
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	SyncedProperties.Reset();
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
 	MySwipeBox = SNew(SSwipeBox)
 		.Style(&WidgetStyle)
@@ -129,22 +433,62 @@ TSharedRef<SWidget> USwipeBox::RebuildWidget()
 		.BlendExp(BlendExp)
 		.Looseness(Looseness)
 		.ScreenPercentValidation(ScreenPercentValidation)
-		.OnUserSwipeed(BIND_UOBJECT_DELEGATE(FOnUserSwipeed, SlateHandleUserSwipeed));
+		.SuspendOffscreenPages(bSuspendOffscreenPages)
+		.SuspendPageHitTestWhileSwiping(bSuspendPageHitTestWhileSwiping)
+		.OnUserSwipeed(BIND_UOBJECT_DELEGATE(FOnUserSwipeed, SlateHandleUserSwipeed))
+		.OnPageWillAppear(BIND_UOBJECT_DELEGATE(FOnSwipePageLifecycle, SlateHandlePageWillAppear))
+		.OnPageDidAppear(BIND_UOBJECT_DELEGATE(FOnSwipePageLifecycle, SlateHandlePageDidAppear))
+		.OnPageDidDisappear(BIND_UOBJECT_DELEGATE(FOnSwipePageLifecycle, SlateHandlePageDidDisappear));
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+	TArray<SSwipeBox::FSlot::FSlotArguments> SlotArguments;
+	SlotArguments.Reserve(Slots.Num());
 	for (UPanelSlot* PanelSlot : Slots)
 	{
 		if (USwipeBoxSlot* TypedSlot = Cast<USwipeBoxSlot>(PanelSlot))
 		{
 			TypedSlot->Parent = this;
-			TypedSlot->BuildSlot(MySwipeBox.ToSharedRef());
+			SlotArguments.Add(MakePageSlotArguments(TypedSlot));
 		}
 	}
+	MySwipeBox->AddSlots(MoveTemp(SlotArguments));
+
+	// When time slicing, the current page is the only one built before the box is first shown.
+	if (USwipeBoxSlot* CurrentSlot = Slots.IsValidIndex(MySwipeBox->GetCurrentPage())
+		                                 ? Cast<USwipeBoxSlot>(Slots[MySwipeBox->GetCurrentPage()])
+		                                 : nullptr)
+	{
+		CurrentSlot->BuildContent(*MySwipeBox);
+	}
+	SchedulePageBuild();
+
+	// Only the pages around the first one start loading their assets, the others stream in as the user swipes.
+	LastStreamingPage = INDEX_NONE;
+	StreamingDirection = 0;
+	UpdatePageStreaming();
 
 	return MySwipeBox.ToSharedRef();
 }
 
+namespace SwipeBoxPrivate
+{
+	/** Copies InValue to InOutSynced and returns true when they differ. */
+	template <typename T>
+	bool UpdateSynced(T& InOutSynced, const T& InValue, bool bForce)
+	{
+		if (!bForce && InOutSynced == InValue)
+		{
+			return false;
+		}
+		InOutSynced = InValue;
+		return true;
+	}
+}
+
 void USwipeBox::SynchronizeProperties()
 {
+	using namespace SwipeBoxPrivate;
+
 	Super::SynchronizeProperties();
 
 	if (!MySwipeBox.IsValid())
@@ -152,24 +496,73 @@ void USwipeBox::SynchronizeProperties()
 		return;
 	}
 
+	const bool bForce = !SyncedProperties.IsSet();
+	FSyncedProperties& Synced = bForce ? SyncedProperties.Emplace() : SyncedProperties.GetValue();
+
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	MySwipeBox->SetSwipeOffset(DesiredSwipeOffset);
-	MySwipeBox->SetOrientation(Orientation);
-	MySwipeBox->SetSwipeBarVisibility(UWidget::ConvertSerializedVisibilityToRuntime(SwipeBarVisibility));
-	MySwipeBox->SetSwipeBarThickness(SwipeBarThickness);
-	MySwipeBox->SetSwipeBarPadding(SwipeBarPadding);
-	MySwipeBox->SetSwipeBarAlwaysVisible(AlwaysShowSwipeBar);
-	MySwipeBox->SetSwipeBarTrackAlwaysVisible(AlwaysShowSwipeBarTrack);
-	MySwipeBox->SetAllowOverSwipe(AllowOverSwipe ? EAllowOverscroll::Yes : EAllowOverscroll::No);
-	MySwipeBox->SetSwipeBarRightClickDragAllowed(bAllowRightClickDragSwipeing);
-	MySwipeBox->SetAllowStickySwipe(AllowStickySwipe ? EAllowStickyswipe::Yes : EAllowStickyswipe::No);
-	MySwipeBox->SetConsumeMouseWheel(ConsumeMouseWheel);
-	MySwipeBox->SetAnimateWheelSwipeing(bAnimateWheelSwipeing);
-	MySwipeBox->SetWheelSwipeMultiplier(WheelSwipeMultiplier);
-	MySwipeBox->SetStyle(&WidgetStyle);
-	MySwipeBox->InvalidateStyle();
-	MySwipeBox->SetSwipeBarStyle(&WidgetBarStyle);
-	MySwipeBox->InvalidateSwipeBarStyle();
+	if (UpdateSynced(Synced.SwipeOffset, DesiredSwipeOffset, bForce))
+	{
+		MySwipeBox->SetSwipeOffset(DesiredSwipeOffset);
+	}
+	if (UpdateSynced(Synced.Orientation, Orientation.GetValue(), bForce))
+	{
+		MySwipeBox->SetOrientation(Orientation);
+	}
+	if (UpdateSynced(Synced.SwipeBarVisibility, SwipeBarVisibility, bForce))
+	{
+		MySwipeBox->SetSwipeBarVisibility(UWidget::ConvertSerializedVisibilityToRuntime(SwipeBarVisibility));
+	}
+	if (UpdateSynced(Synced.SwipeBarThickness, SwipeBarThickness, bForce))
+	{
+		MySwipeBox->SetSwipeBarThickness(SwipeBarThickness);
+	}
+	if (UpdateSynced(Synced.SwipeBarPadding, SwipeBarPadding, bForce))
+	{
+		MySwipeBox->SetSwipeBarPadding(SwipeBarPadding);
+	}
+	if (UpdateSynced(Synced.AlwaysShowSwipeBar, AlwaysShowSwipeBar, bForce))
+	{
+		MySwipeBox->SetSwipeBarAlwaysVisible(AlwaysShowSwipeBar);
+	}
+	if (UpdateSynced(Synced.AlwaysShowSwipeBarTrack, AlwaysShowSwipeBarTrack, bForce))
+	{
+		MySwipeBox->SetSwipeBarTrackAlwaysVisible(AlwaysShowSwipeBarTrack);
+	}
+	if (UpdateSynced(Synced.AllowOverSwipe, AllowOverSwipe, bForce))
+	{
+		MySwipeBox->SetAllowOverSwipe(AllowOverSwipe ? EAllowOverscroll::Yes : EAllowOverscroll::No);
+	}
+	if (UpdateSynced(Synced.bAllowRightClickDragSwipeing, bAllowRightClickDragSwipeing, bForce))
+	{
+		MySwipeBox->SetSwipeBarRightClickDragAllowed(bAllowRightClickDragSwipeing);
+	}
+	if (UpdateSynced(Synced.AllowStickySwipe, AllowStickySwipe, bForce))
+	{
+		MySwipeBox->SetAllowStickySwipe(AllowStickySwipe ? EAllowStickyswipe::Yes : EAllowStickyswipe::No);
+	}
+	if (UpdateSynced(Synced.ConsumeMouseWheel, ConsumeMouseWheel, bForce))
+	{
+		MySwipeBox->SetConsumeMouseWheel(ConsumeMouseWheel);
+	}
+	if (UpdateSynced(Synced.bAnimateWheelSwipeing, bAnimateWheelSwipeing, bForce))
+	{
+		MySwipeBox->SetAnimateWheelSwipeing(bAnimateWheelSwipeing);
+	}
+	if (UpdateSynced(Synced.WheelSwipeMultiplier, WheelSwipeMultiplier, bForce))
+	{
+		MySwipeBox->SetWheelSwipeMultiplier(WheelSwipeMultiplier);
+	}
+	// The Slate widget points at our style structs, it only needs to know when their content changed.
+	if (UpdateSynced(Synced.WidgetStyleSerial, WidgetStyleSerial, bForce))
+	{
+		MySwipeBox->SetStyle(&WidgetStyle);
+		MySwipeBox->InvalidateStyle();
+	}
+	if (UpdateSynced(Synced.WidgetBarStyleSerial, WidgetBarStyleSerial, bForce))
+	{
+		MySwipeBox->SetSwipeBarStyle(&WidgetBarStyle);
+		MySwipeBox->InvalidateSwipeBarStyle();
+	}
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 }
 
@@ -220,6 +613,7 @@ void USwipeBox::SetSwipeOffset(float NewSwipeOffset)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetSwipeOffset(NewSwipeOffset);
+		MarkSynced(&FSyncedProperties::SwipeOffset, NewSwipeOffset);
 	}
 }
 
@@ -290,10 +684,12 @@ PRAGMA_DISABLE_DEPRECATION_WARNINGS
 void USwipeBox::SetWidgetStyle(const FSwipeBoxStyle& NewWidgetStyle)
 {
 	WidgetStyle = NewWidgetStyle;
+	++WidgetStyleSerial;
 
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->InvalidateStyle();
+		MarkSynced(&FSyncedProperties::WidgetStyleSerial, WidgetStyleSerial);
 	}
 }
 
@@ -305,10 +701,12 @@ const FSwipeBoxStyle& USwipeBox::GetWidgetStyle() const
 void USwipeBox::SetWidgetBarStyle(const FSwipeBarStyle& NewWidgetBarStyle)
 {
 	WidgetBarStyle = NewWidgetBarStyle;
+	++WidgetBarStyleSerial;
 
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->InvalidateSwipeBarStyle();
+		MarkSynced(&FSyncedProperties::WidgetBarStyleSerial, WidgetBarStyleSerial);
 	}
 }
 
@@ -339,6 +737,7 @@ void USwipeBox::SetConsumeMouseWheel(EConsumeMouseWheel NewConsumeMouseWheel)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetConsumeMouseWheel(NewConsumeMouseWheel);
+		MarkSynced(&FSyncedProperties::ConsumeMouseWheel, NewConsumeMouseWheel);
 	}
 }
 
@@ -354,6 +753,7 @@ void USwipeBox::SetOrientation(EOrientation NewOrientation)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetOrientation(Orientation);
+		MarkSynced(&FSyncedProperties::Orientation, NewOrientation);
 	}
 }
 
@@ -382,6 +782,7 @@ void USwipeBox::SetSwipeBarVisibility(ESlateVisibility NewSwipeBarVisibility)
 		case ESlateVisibility::Visible: MySwipeBox->SetSwipeBarVisibility(EVisibility::Visible);
 			break;
 		}
+		MarkSynced(&FSyncedProperties::SwipeBarVisibility, NewSwipeBarVisibility);
 	}
 }
 
@@ -397,6 +798,7 @@ void USwipeBox::SetSwipeBarThickness(const FVector2D& NewSwipeBarThickness)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetSwipeBarThickness(SwipeBarThickness);
+		MarkSynced(&FSyncedProperties::SwipeBarThickness, NewSwipeBarThickness);
 	}
 }
 
@@ -412,6 +814,7 @@ void USwipeBox::SetSwipeBarPadding(const FMargin& NewSwipeBarPadding)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetSwipeBarPadding(SwipeBarPadding);
+		MarkSynced(&FSyncedProperties::SwipeBarPadding, NewSwipeBarPadding);
 	}
 }
 
@@ -427,6 +830,7 @@ void USwipeBox::SetAlwaysShowSwipeBar(bool NewAlwaysShowSwipeBar)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetSwipeBarAlwaysVisible(AlwaysShowSwipeBar);
+		MarkSynced(&FSyncedProperties::AlwaysShowSwipeBar, NewAlwaysShowSwipeBar);
 	}
 }
 
@@ -442,6 +846,7 @@ void USwipeBox::SetAllowOverSwipe(bool NewAllowOverSwipe)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetAllowOverSwipe(AllowOverSwipe ? EAllowOverscroll::Yes : EAllowOverscroll::No);
+		MarkSynced(&FSyncedProperties::AllowOverSwipe, NewAllowOverSwipe);
 	}
 }
 
@@ -457,6 +862,7 @@ void USwipeBox::SetAllowStickySwipe(bool NewAllowStickySwipe)
 	if (MySwipeBox.IsValid())
 	{
 		MySwipeBox->SetAllowStickySwipe(AllowStickySwipe ? EAllowStickyswipe::Yes : EAllowStickyswipe::No);
+		MarkSynced(&FSyncedProperties::AllowStickySwipe, NewAllowStickySwipe);
 	}
 }
 
@@ -476,6 +882,7 @@ void USwipeBox::SetAnimateWheelSwipeing(bool bShouldAnimateWheelSwipeing)
 	if (MySwipeBox)
 	{
 		MySwipeBox->SetAnimateWheelSwipeing(bShouldAnimateWheelSwipeing);
+		MarkSynced(&FSyncedProperties::bAnimateWheelSwipeing, bShouldAnimateWheelSwipeing);
 	}
 }
 
@@ -564,11 +971,21 @@ int USwipeBox::GetCurrentPage() const
 	return -1;
 }
 
+float USwipeBox::GetPagePosition() const
+{
+	if (MySwipeBox)
+	{
+		return MySwipeBox->GetPagePosition();
+	}
+	return -1.f;
+}
+
 void USwipeBox::SetCurrentPage(int32 NewCurrentPage, bool ThrowEvent, bool PlayAnimation)
 {
 	if (MySwipeBox)
 	{
 		MySwipeBox->SetCurrentPage(NewCurrentPage, ThrowEvent, PlayAnimation);
+		UpdatePageStreaming();
 	}
 }
 
@@ -578,6 +995,7 @@ void USwipeBox::SetWheelSwipeMultiplier(float NewWheelSwipeMultiplier)
 	if (MySwipeBox)
 	{
 		MySwipeBox->SetWheelSwipeMultiplier(NewWheelSwipeMultiplier);
+		MarkSynced(&FSyncedProperties::WheelSwipeMultiplier, NewWheelSwipeMultiplier);
 	}
 }
 
@@ -614,6 +1032,7 @@ void USwipeBox::SetAlwaysShowSwipeBarTrack(bool NewAlwaysShowSwipeBarTrack)
 	if (MySwipeBox)
 	{
 		MySwipeBox->SetSwipeBarTrackAlwaysVisible(AlwaysShowSwipeBarTrack);
+		MarkSynced(&FSyncedProperties::AlwaysShowSwipeBarTrack, NewAlwaysShowSwipeBarTrack);
 	}
 }
 
@@ -629,16 +1048,17 @@ float USwipeBox::GetNavigationSwipePadding() const
 
 void USwipeBox::SetAllowRightClickDragSwipeing(bool bShouldAllowRightClickDragSwipeing)
 {
-	AlwaysShowSwipeBarTrack = bShouldAllowRightClickDragSwipeing;
+	bAllowRightClickDragSwipeing = bShouldAllowRightClickDragSwipeing;
 	if (MySwipeBox)
 	{
-		MySwipeBox->SetSwipeBarRightClickDragAllowed(AlwaysShowSwipeBarTrack);
+		MySwipeBox->SetSwipeBarRightClickDragAllowed(bAllowRightClickDragSwipeing);
+		MarkSynced(&FSyncedProperties::bAllowRightClickDragSwipeing, bShouldAllowRightClickDragSwipeing);
 	}
 }
 
 bool USwipeBox::IsAllowRightClickDragSwipeing() const
 {
-	return AlwaysShowSwipeBarTrack;
+	return bAllowRightClickDragSwipeing;
 }
 
 bool USwipeBox::IsFrontPadSwipeing() const
@@ -673,9 +1093,390 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 void USwipeBox::SlateHandleUserSwipeed(int32 CurrentPage)
 {
+	UpdatePageStreaming();
 	OnUserSwipeed.Broadcast(CurrentPage);
 }
 
+void USwipeBox::SetStreamingRadius(int32 NewStreamingRadius)
+{
+	NewStreamingRadius = FMath::Max(NewStreamingRadius, 0);
+	if (StreamingRadius != NewStreamingRadius)
+	{
+		StreamingRadius = NewStreamingRadius;
+		UpdatePageStreaming();
+	}
+}
+
+int32 USwipeBox::GetStreamingRadius() const
+{
+	return StreamingRadius;
+}
+
+void USwipeBox::RefreshSlotStreaming(USwipeBoxSlot* InSlot)
+{
+	// The other pages keep their handle, requesting them again returns right away.
+	if (InSlot && Slots.Contains(InSlot))
+	{
+		UpdatePageStreaming();
+	}
+}
+
+void USwipeBox::UpdatePageStreaming()
+{
+	if (!MySwipeBox.IsValid() || bDeferSlateSlotUpdates)
+	{
+		return;
+	}
+
+	const int32 CurrentPage = MySwipeBox->GetCurrentPage();
+	if (LastStreamingPage != INDEX_NONE && CurrentPage != LastStreamingPage)
+	{
+		StreamingDirection = FMath::Sign(CurrentPage - LastStreamingPage);
+	}
+	LastStreamingPage = CurrentPage;
+
+	StreamedPageScratch.Reset();
+	const int32 FirstPage = FMath::Max(CurrentPage - StreamingRadius, 0);
+	const int32 LastPage = FMath::Min(CurrentPage + StreamingRadius, Slots.Num() - 1);
+	for (int32 PageIndex = FirstPage; PageIndex <= LastPage; ++PageIndex)
+	{
+		USwipeBoxSlot* TypedSlot = Cast<USwipeBoxSlot>(Slots[PageIndex]);
+		if (!TypedSlot)
+		{
+			continue;
+		}
+
+		// Each step of distance is worth two priority levels, the odd level breaks the tie toward the swipe direction.
+		const int32 Distance = FMath::Abs(PageIndex - CurrentPage);
+		const bool bAhead = StreamingDirection != 0 && FMath::Sign(PageIndex - CurrentPage) == StreamingDirection;
+		const TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority
+			+ (StreamingRadius - Distance) * 2 + (bAhead ? 1 : 0);
+		TypedSlot->RequestStreamedAssets(Priority, FStreamableDelegate::CreateUObject(
+			                                 this, &USwipeBox::HandlePageAssetsLoaded, TWeakObjectPtr<USwipeBoxSlot>(TypedSlot)));
+		StreamedPageScratch.Add(TypedSlot);
+	}
+
+	// The pages of the last update that are not in the window anymore, after a page change, a smaller radius or slots
+	// inserted before them. Removed slots already released their assets.
+	for (const TWeakObjectPtr<USwipeBoxSlot>& StreamedSlot : StreamedPageSlots)
+	{
+		USwipeBoxSlot* TypedSlot = StreamedSlot.Get();
+		if (TypedSlot && !StreamedPageScratch.Contains(StreamedSlot))
+		{
+			TypedSlot->ReleaseStreamedAssets();
+		}
+	}
+	Swap(StreamedPageSlots, StreamedPageScratch);
+}
+
+void USwipeBox::ReleasePageStreaming()
+{
+	for (UPanelSlot* PanelSlot : Slots)
+	{
+		if (USwipeBoxSlot* TypedSlot = Cast<USwipeBoxSlot>(PanelSlot))
+		{
+			TypedSlot->ReleaseStreamedAssets();
+		}
+	}
+	StreamedPageSlots.Reset();
+	LastStreamingPage = INDEX_NONE;
+	StreamingDirection = 0;
+}
+
+void USwipeBox::HandlePageAssetsLoaded(TWeakObjectPtr<USwipeBoxSlot> LoadedSlot)
+{
+	if (USwipeBoxSlot* TypedSlot = LoadedSlot.Get())
+	{
+		const int32 PageIndex = Slots.IndexOfByKey(TypedSlot);
+		if (PageIndex != INDEX_NONE)
+		{
+			OnPageAssetsLoaded.Broadcast(PageIndex, TypedSlot->Content);
+		}
+	}
+}
+
+void USwipeBox::SetSuspendOffscreenPages(bool bNewSuspendOffscreenPages)
+{
+	bSuspendOffscreenPages = bNewSuspendOffscreenPages;
+	if (!bSuspendOffscreenPages)
+	{
+		ResumePageAnimations();
+	}
+
+	if (MySwipeBox.IsValid())
+	{
+		MySwipeBox->SetSuspendOffscreenPages(bSuspendOffscreenPages);
+	}
+}
+
+bool USwipeBox::IsSuspendOffscreenPages() const
+{
+	return bSuspendOffscreenPages;
+}
+
+void USwipeBox::SetSuspendPageHitTestWhileSwiping(bool bNewSuspendPageHitTestWhileSwiping)
+{
+	bSuspendPageHitTestWhileSwiping = bNewSuspendPageHitTestWhileSwiping;
+	if (MySwipeBox.IsValid())
+	{
+		MySwipeBox->SetSuspendPageHitTestWhileSwiping(bSuspendPageHitTestWhileSwiping);
+	}
+}
+
+bool USwipeBox::IsSuspendPageHitTestWhileSwiping() const
+{
+	return bSuspendPageHitTestWhileSwiping;
+}
+
+void USwipeBox::SetTimeSlicePageBuild(bool bNewTimeSlicePageBuild)
+{
+	bTimeSlicePageBuild = bNewTimeSlicePageBuild;
+	if (!bTimeSlicePageBuild)
+	{
+		BuildPendingPages();
+	}
+}
+
+bool USwipeBox::IsTimeSlicePageBuild() const
+{
+	return bTimeSlicePageBuild;
+}
+
+void USwipeBox::SetPageBuildBudgetMs(float NewPageBuildBudgetMs)
+{
+	PageBuildBudgetMs = FMath::Max(NewPageBuildBudgetMs, 0.f);
+}
+
+float USwipeBox::GetPageBuildBudgetMs() const
+{
+	return PageBuildBudgetMs;
+}
+
+void USwipeBox::FlushPageTeardown()
+{
+	SwipeBoxPrivate::FPageTeardownQueue::Flush();
+}
+
+SSwipeBox::FSlot::FSlotArguments USwipeBox::MakePageSlotArguments(USwipeBoxSlot* InSlot)
+{
+	return InSlot->MakeSlotArguments(!ShouldTimeSlicePageBuild());
+}
+
+bool USwipeBox::ShouldTimeSlicePageBuild() const
+{
+	// The designer shows every page right away.
+	return bTimeSlicePageBuild && !IsDesignTime();
+}
+
+void USwipeBox::SchedulePageBuild()
+{
+	if (PageBuildTickHandle.IsValid() || !MySwipeBox.IsValid() || !ShouldTimeSlicePageBuild())
+	{
+		return;
+	}
+
+	PageBuildTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USwipeBox::TickPageBuild));
+}
+
+bool USwipeBox::TickPageBuild(float DeltaTime)
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	TRACE_CPUPROFILER_EVENT_SCOPE(USwipeBox::TickPageBuild);
+
+	if (!MySwipeBox.IsValid())
+	{
+		PageBuildTickHandle.Reset();
+		return false;
+	}
+
+	// Ordered again every frame, the user may have swiped or jumped to another page since the last one.
+	const int32 CurrentPage = MySwipeBox->GetCurrentPage();
+	TArray<TPair<int32, USwipeBoxSlot*>>& PendingPages = PendingPageScratch;
+	PendingPages.Reset();
+	for (int32 PageIndex = 0; PageIndex < Slots.Num(); ++PageIndex)
+	{
+		USwipeBoxSlot* TypedSlot = Cast<USwipeBoxSlot>(Slots[PageIndex]);
+		if (TypedSlot && !TypedSlot->IsContentBuilt())
+		{
+			// Two steps per page of distance, at the same distance the page in the direction of the last swipe first.
+			const bool bAhead = StreamingDirection != 0 && FMath::Sign(PageIndex - CurrentPage) == StreamingDirection;
+			PendingPages.Emplace(FMath::Abs(PageIndex - CurrentPage) * 2 - (bAhead ? 1 : 0), TypedSlot);
+		}
+	}
+	PendingPages.Sort([](const TPair<int32, USwipeBoxSlot*>& A, const TPair<int32, USwipeBoxSlot*>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	// At least one page per frame, a page costing more than the budget would never be built otherwise.
+	const double EndTime = FPlatformTime::Seconds() + PageBuildBudgetMs / 1000.0;
+	int32 NumBuilt = 0;
+	while (NumBuilt < PendingPages.Num() && (NumBuilt == 0 || FPlatformTime::Seconds() < EndTime))
+	{
+		PendingPages[NumBuilt++].Value->BuildContent(*MySwipeBox);
+	}
+	if (NumBuilt > 0)
+	{
+		MySwipeBox->Invalidate(EInvalidateWidgetReason::Layout);
+	}
+
+	const bool bAllBuilt = NumBuilt == PendingPages.Num();
+	PendingPages.Reset();
+	if (bAllBuilt)
+	{
+		PageBuildTickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void USwipeBox::BuildPendingPages()
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+
+	if (PageBuildTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PageBuildTickHandle);
+		PageBuildTickHandle.Reset();
+	}
+
+	if (!MySwipeBox.IsValid())
+	{
+		return;
+	}
+
+	bool bBuiltAny = false;
+	for (UPanelSlot* PanelSlot : Slots)
+	{
+		if (USwipeBoxSlot* TypedSlot = Cast<USwipeBoxSlot>(PanelSlot))
+		{
+			bBuiltAny |= TypedSlot->BuildContent(*MySwipeBox);
+		}
+	}
+	if (bBuiltAny)
+	{
+		MySwipeBox->Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void USwipeBox::SlateHandlePageWillAppear(int32 PageIndex)
+{
+	UWidget* PageContent = Slots.IsValidIndex(PageIndex) ? Slots[PageIndex]->Content : nullptr;
+	SetPageAnimationsPaused(PageContent, false);
+	OnPageWillAppear.Broadcast(PageIndex, PageContent);
+}
+
+void USwipeBox::SlateHandlePageDidAppear(int32 PageIndex)
+{
+	OnPageDidAppear.Broadcast(PageIndex, Slots.IsValidIndex(PageIndex) ? Slots[PageIndex]->Content : nullptr);
+}
+
+void USwipeBox::SlateHandlePageDidDisappear(int32 PageIndex)
+{
+	UWidget* PageContent = Slots.IsValidIndex(PageIndex) ? Slots[PageIndex]->Content : nullptr;
+	OnPageDidDisappear.Broadcast(PageIndex, PageContent);
+	if (bSuspendOffscreenPages)
+	{
+		SetPageAnimationsPaused(PageContent, true);
+	}
+}
+
+void USwipeBox::SetPageAnimationsPaused(UWidget* PageContent, bool bPaused)
+{
+	UUserWidget* Page = Cast<UUserWidget>(PageContent);
+	if (!Page)
+	{
+		return;
+	}
+
+	if (!bPaused)
+	{
+		TArray<TWeakObjectPtr<UWidgetAnimation>> PausedAnimations;
+		if (PausedPageAnimations.RemoveAndCopyValue(Page, PausedAnimations))
+		{
+			for (const TWeakObjectPtr<UWidgetAnimation>& Animation : PausedAnimations)
+			{
+				if (UWidgetAnimation* PausedAnimation = Animation.Get())
+				{
+					Page->SetPlaybackSpeed(PausedAnimation, 1.f);
+				}
+			}
+		}
+		return;
+	}
+
+	// Freezing the playback speed keeps the play mode, loops and time of each animation for when the page comes back.
+	TArray<TWeakObjectPtr<UWidgetAnimation>>& PausedAnimations = PausedPageAnimations.FindOrAdd(Page);
+	for (UClass* Class = Page->GetClass(); Class; Class = Class->GetSuperClass())
+	{
+		const UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(Class);
+		if (!WidgetClass)
+		{
+			break;
+		}
+		for (UWidgetAnimation* Animation : WidgetClass->Animations)
+		{
+			if (Animation && Page->IsAnimationPlaying(Animation) && !PausedAnimations.Contains(Animation))
+			{
+				Page->SetPlaybackSpeed(Animation, 0.f);
+				PausedAnimations.Add(Animation);
+			}
+		}
+	}
+	if (PausedAnimations.IsEmpty())
+	{
+		PausedPageAnimations.Remove(Page);
+	}
+}
+
+void USwipeBox::ResumePageAnimations()
+{
+	TArray<TWeakObjectPtr<UUserWidget>> PausedPages;
+	PausedPageAnimations.GetKeys(PausedPages);
+	for (const TWeakObjectPtr<UUserWidget>& Page : PausedPages)
+	{
+		SetPageAnimationsPaused(Page.Get(), false);
+	}
+	PausedPageAnimations.Reset();
+}
+
+float USwipeBox::GetInputLatencyPercentile(float Percentile) const
+{
+	if (MySwipeBox.IsValid())
+	{
+		return static_cast<float>(MySwipeBox->GetInputLatency().GetPercentileMs(Percentile));
+	}
+
+	return 0;
+}
+
+int32 USwipeBox::GetInputLatencySampleCount() const
+{
+	if (MySwipeBox.IsValid())
+	{
+		return static_cast<int32>(MySwipeBox->GetInputLatency().GetNumSamples());
+	}
+
+	return 0;
+}
+
+void USwipeBox::ResetInputLatency()
+{
+	if (MySwipeBox.IsValid())
+	{
+		MySwipeBox->ResetInputLatency();
+	}
+}
+
+void USwipeBox::InvalidateKeyboardFocusCache(int32 PageIndex)
+{
+	if (MySwipeBox.IsValid())
+	{
+		MySwipeBox->InvalidateKeyboardFocusCache(PageIndex);
+	}
+}
+
 #if WITH_EDITOR
 
 const FText USwipeBox::GetPaletteCategory()
@@ -683,6 +1484,24 @@ const FText USwipeBox::GetPaletteCategory()
 	return LOCTEXT("Panel", "Panel");
 }
 
+void USwipeBox::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Before the base class synchronizes the properties, so an edited style is pushed to the Slate widget.
+	PRAGMA_DISABLE_DEPRECATION_WARNINGS
+	const FName MemberPropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(USwipeBox, WidgetStyle))
+	{
+		++WidgetStyleSerial;
+	}
+	else if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(USwipeBox, WidgetBarStyle))
+	{
+		++WidgetBarStyleSerial;
+	}
+	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
 void USwipeBox::OnDescendantSelectedByDesigner(UWidget* DescendantWidget)
 {
 	UWidget* SelectedChild = UWidget::FindChildContainingDescendant(this, DescendantWidget);
@@ -2,6 +2,9 @@
 
 #include "UMG/Components/SwipeBoxSlot.h"
 #include "Components/Widget.h"
+#include "Engine/AssetManager.h"
+#include "MobileWidgetSwipeStats.h"
+#include "UMG/Components/SwipeBox.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SwipeBoxSlot)
 
@@ -21,19 +24,64 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 void USwipeBoxSlot::BuildSlot(TSharedRef<SSwipeBox> SwipeBox)
 {
-	auto SizeMax = SwipeBox->GetDesiredSize();
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	SwipeBox->AddSlot(MakeSlotArguments());
+}
+
+SSwipeBox::FSlot::FSlotArguments USwipeBoxSlot::MakeSlotArguments(bool bBuildContent)
+{
+	Placeholder = bBuildContent || Content == nullptr ? nullptr : SSwipeBox::MakePagePlaceholder().ToSharedPtr();
+
+	SSwipeBox::FSlot::FSlotArguments SlotArguments = SSwipeBox::Slot();
 PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	SwipeBox->AddSlot()
+	SlotArguments
         .Padding(Padding)
         .HAlign(HorizontalAlignment)
         .VAlign(VerticalAlignment)
         .Expose(Slot)
-        .MaxSize(SizeMax.X)
+        .Key(Key)
         .SizeParam(UWidget::ConvertSerializedSizeParamToRuntime(Size))
 	[
-			Content == nullptr ? SNullWidget::NullWidget : Content->TakeWidget()
+			Placeholder.IsValid()
+				? Placeholder.ToSharedRef()
+				: Content == nullptr ? SNullWidget::NullWidget : Content->TakeWidget()
 		];
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
+	return SlotArguments;
+}
+
+bool USwipeBoxSlot::BuildContent(SSwipeBox& SwipeBox)
+{
+	if (!Slot || !Placeholder.IsValid())
+	{
+		return false;
+	}
+
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	const TSharedRef<SWidget> BuiltPlaceholder = Placeholder.ToSharedRef();
+	Placeholder.Reset();
+	// Through the box so its page index follows the new content, the placeholder dies with the swap.
+	SwipeBox.ReplaceSlotContent(*BuiltPlaceholder, Content == nullptr ? SNullWidget::NullWidget : Content->TakeWidget());
+	return true;
+}
+
+void USwipeBoxSlot::DeferContentRelease()
+{
+	bDeferContentRelease = true;
+}
+
+bool USwipeBoxSlot::IsContentBuilt() const
+{
+	return !Placeholder.IsValid();
+}
+
+TSharedPtr<SWidget> USwipeBoxSlot::GetSlotWidget() const
+{
+	if (Placeholder.IsValid())
+	{
+		return Placeholder;
+	}
+	return Content ? Content->GetCachedWidget() : nullptr;
 }
 
 PRAGMA_DISABLE_DEPRECATION_WARNINGS
@@ -65,6 +113,95 @@ void USwipeBoxSlot::SetSize(FSlateChildSize InSize)
 	}
 }
 
+FName USwipeBoxSlot::GetKey() const
+{
+	return Key;
+}
+
+void USwipeBoxSlot::SetKey(FName InKey)
+{
+	Key = InKey;
+}
+
+const TArray<TSoftObjectPtr<UObject>>& USwipeBoxSlot::GetStreamedAssets() const
+{
+	return StreamedAssets;
+}
+
+void USwipeBoxSlot::SetStreamedAssets(const TArray<TSoftObjectPtr<UObject>>& InStreamedAssets)
+{
+	if (StreamedAssets == InStreamedAssets)
+	{
+		return;
+	}
+
+	StreamedAssets = InStreamedAssets;
+	ReleaseStreamedAssets();
+	if (USwipeBox* SwipeBox = Cast<USwipeBox>(Parent))
+	{
+		SwipeBox->RefreshSlotStreaming(this);
+	}
+}
+
+void USwipeBoxSlot::RequestStreamedAssets(TAsyncLoadPriority InPriority, FStreamableDelegate InOnLoaded)
+{
+	if (StreamingHandle.IsValid() && (StreamingHandle->HasLoadCompleted() || StreamingPriority == InPriority))
+	{
+		return;
+	}
+
+	// Without an asset manager the page content loads its soft references itself.
+	if (StreamedAssets.IsEmpty() || !UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	AssetPaths.Reserve(StreamedAssets.Num());
+	for (const TSoftObjectPtr<UObject>& Asset : StreamedAssets)
+	{
+		if (!Asset.IsNull())
+		{
+			AssetPaths.Add(Asset.ToSoftObjectPath());
+		}
+	}
+	if (AssetPaths.IsEmpty())
+	{
+		return;
+	}
+
+	// A handle cannot be re-prioritized, the new one takes over the loads before the old one is cancelled.
+	const TSharedPtr<FStreamableHandle> PreviousHandle = MoveTemp(StreamingHandle);
+	StreamingHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), MoveTemp(InOnLoaded), InPriority);
+	StreamingPriority = InPriority;
+
+	if (PreviousHandle.IsValid())
+	{
+		PreviousHandle->CancelHandle();
+	}
+}
+
+void USwipeBoxSlot::ReleaseStreamedAssets()
+{
+	if (StreamingHandle.IsValid())
+	{
+		if (StreamingHandle->HasLoadCompleted())
+		{
+			StreamingHandle->ReleaseHandle();
+		}
+		else
+		{
+			StreamingHandle->CancelHandle();
+		}
+		StreamingHandle.Reset();
+	}
+}
+
+bool USwipeBoxSlot::AreStreamedAssetsLoaded() const
+{
+	return StreamingHandle.IsValid() && StreamingHandle->HasLoadCompleted();
+}
+
 EHorizontalAlignment USwipeBoxSlot::GetHorizontalAlignment() const
 {
 	return Slot ? Slot->GetHorizontalAlignment() : HorizontalAlignment.GetValue();
@@ -96,17 +233,40 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 void USwipeBoxSlot::SynchronizeProperties()
 {
+	// Compare with the live slot, every Slate setter invalidates the layout even when the value is the same.
+	if (!Slot)
+	{
+		return;
+	}
+
 PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	SetPadding(Padding);
-	SetHorizontalAlignment(HorizontalAlignment);
-	SetVerticalAlignment(VerticalAlignment);
+	if (Slot->GetPadding() != Padding)
+	{
+		SetPadding(Padding);
+	}
+	if (Slot->GetHorizontalAlignment() != HorizontalAlignment)
+	{
+		SetHorizontalAlignment(HorizontalAlignment);
+	}
+	if (Slot->GetVerticalAlignment() != VerticalAlignment)
+	{
+		SetVerticalAlignment(VerticalAlignment);
+	}
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
-	SetSize(Size);
+
+	const FSizeParam SizeParam = UWidget::ConvertSerializedSizeParamToRuntime(Size);
+	if (Slot->GetSizeRule() != SizeParam.SizeRule || Slot->GetSizeValue() != SizeParam.Value.Get())
+	{
+		SetSize(Size);
+	}
 }
 
 void USwipeBoxSlot::ReleaseSlateResources(bool bReleaseChildren)
 {
-	Super::ReleaseSlateResources(bReleaseChildren);
+	Super::ReleaseSlateResources(bReleaseChildren && !bDeferContentRelease);
+	bDeferContentRelease = false;
 	Slot = nullptr;
+	Placeholder.Reset();
+	ReleaseStreamedAssets();
 }
 
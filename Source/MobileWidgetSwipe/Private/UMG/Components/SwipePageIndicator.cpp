@@ -0,0 +1,231 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UMG/Components/SwipePageIndicator.h"
+
+#include "WidgetSwipeStyle.h"
+#include "MobileWidgetSwipeStats.h"
+#include "Slate/Widgets/Layout/SSwipePageIndicator.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SwipePageIndicator)
+
+#define LOCTEXT_NAMESPACE "UMG"
+
+/////////////////////////////////////////////////////
+// USwipePageIndicator
+
+USwipePageIndicator::USwipePageIndicator(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SetVisibilityInternal(ESlateVisibility::Visible);
+
+	// Like USwipeBox, the default brush does not need the style set.
+	DotBrush = FWidgetSwipeStyle::GetDefaultDotBrush();
+}
+
+void USwipePageIndicator::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyIndicator.Reset();
+}
+
+TSharedRef<SWidget> USwipePageIndicator::RebuildWidget()
+{
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	MyIndicator = SNew(SSwipePageIndicator)
+		.NumPages(NumPages)
+		.PagePosition(PagePosition)
+		.Orientation(Orientation)
+		.DotBrush(&DotBrush)
+		.DotSize(FVector2f(DotSize))
+		.DotSpacing(DotSpacing)
+		.MaxVisibleDots(MaxVisibleDots)
+		.DotColor(DotColor)
+		.ActiveDotColor(ActiveDotColor)
+		.OnPageClicked(BIND_UOBJECT_DELEGATE(FOnPageIndicatorClicked, SlateHandlePageClicked));
+	SyncedDotBrushSerial = DotBrushSerial;
+
+	return MyIndicator.ToSharedRef();
+}
+
+void USwipePageIndicator::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (!MyIndicator.IsValid())
+	{
+		return;
+	}
+
+	MyIndicator->SetNumPages(NumPages);
+	MyIndicator->SetPagePosition(PagePosition);
+	MyIndicator->SetOrientation(Orientation);
+	// The other setters ignore values the indicator already has, a synchronization that changes nothing costs no repaint.
+	if (SyncedDotBrushSerial != DotBrushSerial)
+	{
+		SyncedDotBrushSerial = DotBrushSerial;
+		MyIndicator->SetDotBrush(&DotBrush);
+	}
+	MyIndicator->SetDotSize(FVector2f(DotSize));
+	MyIndicator->SetDotSpacing(DotSpacing);
+	MyIndicator->SetMaxVisibleDots(MaxVisibleDots);
+	MyIndicator->SetDotColor(DotColor);
+	MyIndicator->SetActiveDotColor(ActiveDotColor);
+}
+
+void USwipePageIndicator::SlateHandlePageClicked(int32 PageIndex)
+{
+	OnPageClicked.Broadcast(PageIndex);
+}
+
+void USwipePageIndicator::SetNumPages(int32 InNumPages)
+{
+	NumPages = FMath::Max(InNumPages, 0);
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetNumPages(NumPages);
+	}
+}
+
+int32 USwipePageIndicator::GetNumPages() const
+{
+	return NumPages;
+}
+
+void USwipePageIndicator::SetPagePosition(float InPagePosition)
+{
+	PagePosition = InPagePosition;
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetPagePosition(PagePosition);
+	}
+}
+
+float USwipePageIndicator::GetPagePosition() const
+{
+	return PagePosition;
+}
+
+void USwipePageIndicator::SetOrientation(EOrientation InOrientation)
+{
+	Orientation = InOrientation;
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetOrientation(Orientation);
+	}
+}
+
+EOrientation USwipePageIndicator::GetOrientation() const
+{
+	return Orientation;
+}
+
+void USwipePageIndicator::SetDotBrush(const FSlateBrush& InDotBrush)
+{
+	DotBrush = InDotBrush;
+	++DotBrushSerial;
+	if (MyIndicator.IsValid())
+	{
+		SyncedDotBrushSerial = DotBrushSerial;
+		MyIndicator->SetDotBrush(&DotBrush);
+	}
+}
+
+const FSlateBrush& USwipePageIndicator::GetDotBrush() const
+{
+	return DotBrush;
+}
+
+void USwipePageIndicator::SetDotSize(FVector2D InDotSize)
+{
+	DotSize = InDotSize;
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetDotSize(FVector2f(DotSize));
+	}
+}
+
+FVector2D USwipePageIndicator::GetDotSize() const
+{
+	return DotSize;
+}
+
+void USwipePageIndicator::SetDotSpacing(float InDotSpacing)
+{
+	DotSpacing = InDotSpacing;
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetDotSpacing(DotSpacing);
+	}
+}
+
+float USwipePageIndicator::GetDotSpacing() const
+{
+	return DotSpacing;
+}
+
+void USwipePageIndicator::SetMaxVisibleDots(int32 InMaxVisibleDots)
+{
+	MaxVisibleDots = FMath::Max(InMaxVisibleDots, 1);
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetMaxVisibleDots(MaxVisibleDots);
+	}
+}
+
+int32 USwipePageIndicator::GetMaxVisibleDots() const
+{
+	return MaxVisibleDots;
+}
+
+void USwipePageIndicator::SetDotColor(FSlateColor InDotColor)
+{
+	DotColor = InDotColor;
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetDotColor(DotColor);
+	}
+}
+
+FSlateColor USwipePageIndicator::GetDotColor() const
+{
+	return DotColor;
+}
+
+void USwipePageIndicator::SetActiveDotColor(FSlateColor InActiveDotColor)
+{
+	ActiveDotColor = InActiveDotColor;
+	if (MyIndicator.IsValid())
+	{
+		MyIndicator->SetActiveDotColor(ActiveDotColor);
+	}
+}
+
+FSlateColor USwipePageIndicator::GetActiveDotColor() const
+{
+	return ActiveDotColor;
+}
+
+#if WITH_EDITOR
+
+const FText USwipePageIndicator::GetPaletteCategory()
+{
+	return LOCTEXT("Common", "Common");
+}
+
+void USwipePageIndicator::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Before the base class synchronizes the properties, so an edited brush is repainted.
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(USwipePageIndicator, DotBrush))
+	{
+		++DotBrushSerial;
+	}
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
+#endif
+
+/////////////////////////////////////////////////////
+
+#undef LOCTEXT_NAMESPACE
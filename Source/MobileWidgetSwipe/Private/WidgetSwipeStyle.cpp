@@ -2,16 +2,44 @@
 
 #include "WidgetSwipeStyle.h"
 #include "Styling/SlateStyleRegistry.h"
+#include "Brushes/SlateBoxBrush.h"
+#include "Brushes/SlateRoundedBoxBrush.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Styling/CoreStyle.h"
 #include "Slate/Styling/SlateTypesExtension.h"
+#include "MobileWidgetSwipeStats.h"
+#include "Interfaces/IPluginManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 
 TSharedPtr< FSlateStyleSet > FWidgetSwipeStyle::WidgetSwipeStyleIconsInstance = NULL;
 TSharedPtr< FSlateStyleSet > FWidgetSwipeStyle::WidgetSwipeStyleSlateInstance = NULL;
 
+namespace WidgetSwipeStylePrivate
+{
+	/** @return the Resources directory of the plugin, wherever it is installed: project, engine or marketplace. */
+	FString GetResourcesDir()
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("MobileWidgetSwipe"));
+		if (ensure(Plugin.IsValid()))
+		{
+			return Plugin->GetBaseDir() / TEXT("Resources");
+		}
+		return FPaths::ProjectPluginsDir() / TEXT("MobileWidgetSwipe/Resources");
+	}
+
+	/** @return the path of the Slate image RelativePath of the plugin. */
+	FString GetSlateImagePath(const TCHAR* RelativePath)
+	{
+		static const FString SlateResourcesDir = GetResourcesDir() / TEXT("Slate");
+		return SlateResourcesDir / RelativePath + TEXT(".png");
+	}
+}
+
 void FWidgetSwipeStyle::Initialize()
 {
+	LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FWidgetSwipeStyle::Initialize);
 #if WITH_EDITOR
 	if (GIsEditor)
 	{
@@ -24,8 +52,16 @@ void FWidgetSwipeStyle::Initialize()
 	}
 #endif
 
+	InitializeSlateStyle();
+}
+
+void FWidgetSwipeStyle::InitializeSlateStyle()
+{
 	if ( !WidgetSwipeStyleSlateInstance.IsValid() )
 	{
+		LLM_SCOPE_BYTAG(MobileWidgetSwipe);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FWidgetSwipeStyle::InitializeSlateStyle);
+
 		WidgetSwipeStyleSlateInstance = CreateSlateStyle();
 		FSlateStyleRegistry::RegisterSlateStyle( *WidgetSwipeStyleSlateInstance );
 	}
@@ -33,13 +69,37 @@ void FWidgetSwipeStyle::Initialize()
 
 void FWidgetSwipeStyle::Shutdown()
 {
-	FSlateStyleRegistry::UnRegisterSlateStyle( *WidgetSwipeStyleIconsInstance );
-	ensure( WidgetSwipeStyleIconsInstance.IsUnique() );
-	WidgetSwipeStyleIconsInstance.Reset();
+	if ( WidgetSwipeStyleIconsInstance.IsValid() )
+	{
+		FSlateStyleRegistry::UnRegisterSlateStyle( *WidgetSwipeStyleIconsInstance );
+		ensure( WidgetSwipeStyleIconsInstance.IsUnique() );
+		WidgetSwipeStyleIconsInstance.Reset();
+	}
 
-	FSlateStyleRegistry::UnRegisterSlateStyle( *WidgetSwipeStyleSlateInstance );
-	ensure( WidgetSwipeStyleSlateInstance.IsUnique() );
-	WidgetSwipeStyleSlateInstance.Reset();
+	if ( WidgetSwipeStyleSlateInstance.IsValid() )
+	{
+		FSlateStyleRegistry::UnRegisterSlateStyle( *WidgetSwipeStyleSlateInstance );
+		ensure( WidgetSwipeStyleSlateInstance.IsUnique() );
+		WidgetSwipeStyleSlateInstance.Reset();
+	}
+}
+
+const FSwipeBoxStyle& FWidgetSwipeStyle::GetDefaultSwipeBoxStyle()
+{
+	using WidgetSwipeStylePrivate::GetSlateImagePath;
+	static const FSwipeBoxStyle SwipeBoxStyle = FSwipeBoxStyle()
+		.SetTopShadowBrush(FSlateBoxBrush(GetSlateImagePath(TEXT("SwipeBoxShadowTop")), FVector2f(16.f, 8.f), FMargin(0.5f, 1.f, 0.5f, 0.f)))
+		.SetBottomShadowBrush(FSlateBoxBrush(GetSlateImagePath(TEXT("SwipeBoxShadowBottom")), FVector2f(16.f, 8.f), FMargin(0.5f, 0.f, 0.5f, 1.f)))
+		.SetLeftShadowBrush(FSlateBoxBrush(GetSlateImagePath(TEXT("SwipeBoxShadowLeft")), FVector2f(8.f, 16.f), FMargin(1.f, 0.5f, 0.f, 0.5f)))
+		.SetRightShadowBrush(FSlateBoxBrush(GetSlateImagePath(TEXT("SwipeBoxShadowRight")), FVector2f(8.f, 16.f), FMargin(0.f, 0.5f, 1.f, 0.5f)))
+		.SetBarThickness(37.0);
+	return SwipeBoxStyle;
+}
+
+const FSlateBrush& FWidgetSwipeStyle::GetDefaultDotBrush()
+{
+	static const FSlateRoundedBoxBrush DotBrush(FLinearColor::White, 4.f, FVector2f(8.f, 8.f));
+	return DotBrush;
 }
 
 FName FWidgetSwipeStyle::GetStyleSetName()
@@ -62,7 +122,7 @@ TSharedRef< FSlateStyleSet > FWidgetSwipeStyle::CreateIconsStyle()
 {
 	TSharedRef< FSlateStyleSet > Style = MakeShareable(new FSlateStyleSet("WidgetSwipeStyle"));
 
-		Style->SetContentRoot(FPaths::ProjectPluginsDir() / TEXT("MobileWidgetSwipe/Resources/Icons"));
+		Style->SetContentRoot(WidgetSwipeStylePrivate::GetResourcesDir() / TEXT("Icons"));
 	
 	
 		Style->Set("ClassIcon.SwipeBox", new IMAGE_BRUSH_SVG(TEXT("SwipeBox"), Icon16x16));
@@ -76,16 +136,14 @@ TSharedRef< FSlateStyleSet > FWidgetSwipeStyle::CreateIconsStyle()
 TSharedRef< FSlateStyleSet > FWidgetSwipeStyle::CreateSlateStyle()
 {
 	TSharedRef<FSlateStyleSet> Style = MakeShareable(new FSlateStyleSet("WidgetSwipeSlateStyle"));
-	Style->SetContentRoot(FPaths::EngineContentDir() / TEXT("Slate"));
-	Style->SetCoreContentRoot(FPaths::EngineContentDir() / TEXT("Slate"));
+	// The plugin ships the few images it needs, the engine Slate content is not staged for it.
+	const FString SlateResourcesDir = WidgetSwipeStylePrivate::GetResourcesDir() / TEXT("Slate");
+	Style->SetContentRoot(SlateResourcesDir);
+	Style->SetCoreContentRoot(SlateResourcesDir);
 	
-	Style->Set("SwipeBox", FSwipeBoxStyle()
-		.SetTopShadowBrush(BOX_BRUSH("Common/ScrollBoxShadowTop", FVector2f(16.f, 8.f), FMargin(0.5f, 1.f, 0.5f, 0.f)))
-		.SetBottomShadowBrush(BOX_BRUSH("Common/ScrollBoxShadowBottom", FVector2f(16.f, 8.f), FMargin(0.5f, 0.f, 0.5f, 1.f)))
-		.SetLeftShadowBrush(BOX_BRUSH("Common/ScrollBoxShadowLeft", FVector2f(8.f, 16.f), FMargin(1.f, 0.5f, 0.f, 0.5f)))
-		.SetRightShadowBrush(BOX_BRUSH("Common/ScrollBoxShadowRight", FVector2f(8.f, 16.f), FMargin(0.f, 0.5f, 1.f, 0.5f)))
-		.SetBarThickness(37.0)
-	);
+	// Same values as the class default objects, see GetDefaultSwipeBoxStyle.
+	Style->Set("SwipeBox", GetDefaultSwipeBoxStyle());
+	Style->Set("SwipePageIndicator.Dot", new FSlateBrush(GetDefaultDotBrush()));
 	return Style;
 }
 
@@ -100,5 +158,10 @@ void FWidgetSwipeStyle::ReloadTextures()
 
 const TSharedPtr<ISlateStyle> FWidgetSwipeStyle::Get()
 {
+	// Created on first use, the style registry is only modified on the game thread.
+	if (!WidgetSwipeStyleSlateInstance.IsValid() && IsInGameThread())
+	{
+		InitializeSlateStyle();
+	}
 	return WidgetSwipeStyleSlateInstance;
 }
@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Blueprint/UserWidget.h"
+#include "SwipeBoxBenchmarkCommandlet.generated.h"
+
+class USwipeBox;
+
+/** Concrete user widget used as a page by the benchmark, UUserWidget itself is abstract. */
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class USwipeBoxBenchmarkPage : public UUserWidget
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Times the UMG side of USwipeBox: construction, TakeWidget, SynchronizeProperties, child churn, rebuild cycles
+ * and batched replacement of the children of a live box. Also compares the scalar and vectorized computation of the
+ * slot spans of the stack layout, on synthetic children.
+ * Does not need a GPU, run it with -nullrhi:
+ *
+ *   UnrealEditor-Cmd.exe <Project> -run=SwipeBoxBenchmark -nullrhi [-Pages=10,100,1000] [-Iterations=20]
+ *       [-StackChildren=1000,10000,100000] [-Report=<File.json>]
+ *
+ * The report is written as JSON, by default under Saved/Profiling/SwipeBox.
+ */
+UCLASS()
+class USwipeBoxBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USwipeBoxBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/** Timings in milliseconds of one benchmark case for a given page count. */
+	struct FCaseResult
+	{
+		FString Name;
+		int32 NumPages = 0;
+		TArray<double> SamplesMs;
+	};
+
+	/** Makes a minimal user widget page with a small content tree. */
+	USwipeBoxBenchmarkPage* CreatePage(UObject* Outer, int32 PageIndex) const;
+
+	/** Runs every benchmark case for NumPages pages. */
+	void RunCases(int32 NumPages, int32 NumIterations, TArray<FCaseResult>& OutResults) const;
+
+	/**
+	 * Times SSwipePanel::ComputeChildSpans with and without vectorization for NumChildren children.
+	 * @return false when both paths disagree on the layout.
+	 */
+	bool RunStackSpanCases(int32 NumChildren, int32 NumIterations, TArray<FCaseResult>& OutResults) const;
+
+	bool WriteReport(const FString& FileName, const TArray<FCaseResult>& Results) const;
+};
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SwipeBoxSoakCommandlet.generated.h"
+
+class SSwipeBox;
+class SWindow;
+class USwipeBox;
+
+/**
+ * Repeatedly repopulates swipe boxes and fails when memory or UObject counts keep growing.
+ * Each iteration adds and removes Slate slots, changes page with and without animation, requests a swipe to a
+ * widget that is removed before the next paint, paints the box so its active timers run, and periodically clears
+ * the box and rebuilds a USwipeBox, half of the time with a time sliced page build it removes children from before
+ * every page is built.
+ * Does not need a GPU, run it with -nullrhi:
+ *
+ *   UnrealEditor-Cmd.exe <Project> -run=SwipeBoxSoak -nullrhi [-Iterations=100000] [-SampleInterval=1000]
+ *       [-MaxGrowthMB=16] [-MaxObjectGrowth=64]
+ *
+ * Returns a non-zero exit code when the samples grow monotonically by more than the thresholds, or when swipe
+ * boxes are still alive once every box was released, or when removing children of a time sliced box leaves their
+ * slots in the Slate box.
+ *
+ * With -CountAllocations, it instead swipes a Slate box back and forth with touch drags and the mouse wheel for a
+ * number of frames once warmed up and fails if any frame allocated from the heap:
+ *
+ *   UnrealEditor-Cmd.exe <Project> -run=SwipeBoxSoak -nullrhi -CountAllocations [-Frames=1000]
+ */
+UCLASS()
+class USwipeBoxSoakCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USwipeBoxSoakCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/** Memory and object counts taken after a garbage collection. */
+	struct FSample
+	{
+		int32 Iteration = 0;
+		uint64 UsedMemory = 0;
+		int32 NumObjects = 0;
+		int32 NumSwipeBoxes = 0;
+	};
+
+	/**
+	 * Runs one soak iteration on the Slate box, Pages mirrors the content of its slots. The box is painted through
+	 * Window, which hosts it, so its active timers run as they would in a frame of the application.
+	 */
+	void RunSlateIteration(SWindow& Window, SSwipeBox& SwipeBox, TArray<TSharedRef<SWidget>>& Pages, int32 Iteration) const;
+
+	/**
+	 * Releases and rebuilds the UMG box, recreating its children. Every other rebuild time slices the page build
+	 * and removes children while only some pages are built.
+	 * @return false when the Slate box kept slots of removed children.
+	 */
+	bool RunUMGIteration(USwipeBox& SwipeBox, int32 Iteration) const;
+
+	FSample TakeSample(int32 Iteration) const;
+
+	/**
+	 * Drags and settles a Slate box page after page, alternating touch and wheel gestures, ticking and arranging it
+	 * every frame.
+	 * @return the number of game thread allocations made over NumFrames frames, after a warm up.
+	 */
+	int32 CountSwipeAllocations(int32 NumFrames) const;
+
+	/**
+	 * @return true when every step between two samples grows (allowing one step in ten to shrink) and the
+	 *         total growth exceeds the threshold.
+	 */
+	static bool IsGrowingMonotonically(const TArray<double>& Values, double Threshold);
+};
@@ -0,0 +1,9 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/** LLM tag covering swipe boxes, their slots, styles and the page content they build. */
+LLM_DECLARE_TAG_API(MobileWidgetSwipe, MOBILEWIDGETSWIPE_API);
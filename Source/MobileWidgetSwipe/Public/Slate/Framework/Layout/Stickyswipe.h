@@ -39,10 +39,10 @@ public:
 	float SwipeBy(const FGeometry& AllottedGeometry, float LocalDeltaScroll, bool InActionFromUser);
 
 	/** How far the widget is uncentered. */
-	float GetStickyswipe(const FGeometry& AllottedGeometry) const;
+	double GetStickyswipe(const FGeometry& AllottedGeometry) const;
 
 	/** Ticks the stickyscroll manager so it can animate. */
-	bool UpdateStickyswipe(const TSharedRef<SPanel> Panel, const FGeometry& AllottedGeometry, float InDeltaTime);
+	bool UpdateStickyswipe(SPanel& Panel, const FGeometry& AllottedGeometry, float InDeltaTime);
 
 	void OnUserReleaseInterraction();
 
@@ -96,6 +96,12 @@ public:
 	}
 
 	void SetCurrentPage(int NewPage, bool ThrowEvent, bool PlayAnimation);
+
+	/**
+	 * Changes the index of the current page after pages were inserted or removed before it, shifting the swipe
+	 * offsets by the same amount so the page stays where it is on screen and a running animation continues.
+	 */
+	void RebaseCurrentPage(int NewPage, int NumPages);
 	
 	EOrientation GetOrientation() const
 	{
@@ -107,7 +113,30 @@ public:
 		this->Orientation = NewOrientation;
 	}
 	
-	float GetDistanceFromEnd() const;
+	double GetDistanceFromEnd() const;
+
+	/** Swipe offset of the page the widget is snapping to. */
+	double GetTargetPoint() const
+	{
+		return TargetPoint;
+	}
+
+	/** Current offset before the looseness is applied. */
+	double GetStickyswipeAmount() const
+	{
+		return StickyswipeAmount;
+	}
+
+	/** Page under the current offset, the fraction being the progress toward the next page. */
+	double GetPagePosition() const
+	{
+		return PageSwipeStep > 0.0 ? StickyswipeAmount / PageSwipeStep : static_cast<double>(CurrentPageId);
+	}
+
+	EStickyMode GetMode() const
+	{
+		return CurrentMode;
+	}
 
 	float GetScreenPercentDistanceUserChangePage() const;
 	void SetScreenPercentDistanceUserChangePage(float InScreenPercentDistanceUserChangePage);
@@ -115,7 +144,11 @@ public:
 	void SetLooseness(float InLooseness);
 
 private:
-	float GetPageSwipeValue(const FGeometry* AllottedGeometry, const int PageId) const;
+	/**
+	 * Offsets are page index times page size, kept in double so a page far from the first one still lands on an
+	 * exact pixel, a float only has 24 bits for it.
+	 */
+	double GetPageSwipeValue(const FGeometry* AllottedGeometry, const int PageId) const;
 	/** How much we've over-scrolled above/below the beginning/end of the list, stored in log form */
 	
 	EEasingFunc::Type Easing;
@@ -129,14 +162,17 @@ private:
 
 	const FGeometry* LastAllottedGeometry;
 	int32 LastChildId = -1;
+
+	/** Swipe offset between two consecutive pages, as of the last update. */
+	double PageSwipeStep = 0.0;
 	
-	float StickyswipeAmount;
-	float StickyswipeAmountStart;
+	double StickyswipeAmount;
+	double StickyswipeAmountStart;
 	float AlphaTarget;
 	float SwipeAmountSinceUserMove;
 
-	float TargetPoint;
-	float MaxValue;
+	double TargetPoint;
+	double MaxValue;
 	EStickyMode CurrentMode = EStickyMode::StickyToOrigin;
 
 	bool UserSwipeEnd = false;
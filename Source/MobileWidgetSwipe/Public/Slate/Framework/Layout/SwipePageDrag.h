@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Input/Reply.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Types/SlateEnums.h"
+
+class SWidget;
+struct FPointerEvent;
+
+/**
+ * Drag and snap state of the panels that move one page at a time, SSwipeCarousel and SSwipeGrid: the finger owning
+ * the gesture, the drag trigger and the axis it locked, the translation of the current page and its snap animation.
+ * The panel owns the pages, it moves its current page by the steps returned here and picks where a release snaps.
+ */
+class MOBILEWIDGETSWIPE_API FSwipePageDrag
+{
+public:
+	/** @param InOwner The panel, its layout is invalidated when the offset changes and it captures the dragging finger. */
+	explicit FSwipePageDrag(SWidget& InOwner);
+
+	/** Snap animation settings, same meaning as in SSwipeBox. */
+	EEasingFunc::Type Easing = EEasingFunc::ExpoOut;
+	float BlendExp = 2.f;
+	float Speed = 2.f;
+
+	/** Translation of the current page, positive when the previous column or row comes in. */
+	const FVector2f& GetOffset() const
+	{
+		return Offset;
+	}
+
+	void SetOffset(const FVector2f& InOffset);
+
+	bool IsAnimating() const
+	{
+		return bAnimating;
+	}
+
+	/** Starts the snap animation toward InTargetOffset. */
+	void AnimateTo(const FVector2f& InTargetOffset);
+
+	/** Stops the snap animation where it is. */
+	void StopAnimation()
+	{
+		bAnimating = false;
+	}
+
+	/**
+	 * Jumps a running page change to its end so consecutive page changes move one page each. The offset moves back by
+	 * one page, the pages stay where they are on screen.
+	 * @return the step the panel moves its current page by, zero when no page change was running.
+	 */
+	FIntPoint FinishPageChange(const FVector2f& InPageSize);
+
+	/**
+	 * Advances the snap animation.
+	 * @return the step the panel moves its current page by when the animation just landed on another page, the offset
+	 *         is back to zero then. Zero otherwise.
+	 */
+	FIntPoint TickAnimation(float InDeltaTime);
+
+	/** @return true when a drag locked an axis and the pages follow the finger. */
+	bool IsDragging() const
+	{
+		return DragAxis.IsSet();
+	}
+
+	/** Axis of the running drag, valid while IsDragging. */
+	EOrientation GetDragAxis() const
+	{
+		return DragAxis.GetValue();
+	}
+
+	/** Starts tracking a touch when no other finger owns the gesture, grabbing the pages where they are. */
+	void OnPreviewTouchStarted(const FPointerEvent& InTouchEvent);
+
+	/**
+	 * Runs the drag trigger for a move of the finger owning the gesture.
+	 * @param InFixedAxis The only axis the panel swipes on, unset to lock the axis with the most travel.
+	 * @return the reply of the move when it is not for the pages to follow, unset when the panel moves its pages by the
+	 *         cursor delta along GetDragAxis.
+	 */
+	TOptional<FReply> OnTouchMoved(const FPointerEvent& InTouchEvent, TOptional<EOrientation> InFixedAxis = {});
+
+	/**
+	 * Ends the touch of the finger owning the gesture. InSnap is called with the axis to snap along when the release
+	 * ends a drag, or when a tap stopped a snap animation midway.
+	 */
+	FReply OnTouchEnded(const FPointerEvent& InTouchEvent, TFunctionRef<void(EOrientation)> InSnap);
+
+	/** Snaps a drag that lost its capture, see OnTouchEnded. */
+	void OnMouseCaptureLost(TFunctionRef<void(EOrientation)> InSnap);
+
+	/**
+	 * @return true when a page translated by InPosition from the view shows in it. Pages that are fully outside are not
+	 *         arranged, so they are neither painted nor hit tested.
+	 */
+	static bool IsPageInView(const FVector2f& InPosition, const FVector2f& InPageSize)
+	{
+		return FMath::Abs(InPosition.X) < InPageSize.X && FMath::Abs(InPosition.Y) < InPageSize.Y;
+	}
+
+private:
+	/** @return true when InPointerEvent comes from the finger owning the gesture. */
+	bool IsOwningFinger(const FPointerEvent& InPointerEvent) const;
+
+	void ResetTouch();
+
+	/** @return the step toward the page the animation target shows. */
+	FIntPoint GetTargetStep() const;
+
+	SWidget& Owner;
+
+	FVector2f Offset = FVector2f::ZeroVector;
+
+	FVector2f AnimationStart = FVector2f::ZeroVector;
+	FVector2f AnimationTarget = FVector2f::ZeroVector;
+	float AnimationAlpha = 0.f;
+	bool bAnimating = false;
+
+	/** Touch tracking, the owner only captures the finger and locks an axis once it moved past the drag trigger distance. */
+	TOptional<int32> FingerOwningTouchInteraction;
+	FVector2f PendingSwipeTriggerAmount = FVector2f::ZeroVector;
+	TOptional<EOrientation> DragAxis;
+};
@@ -0,0 +1,40 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Fixed size latency histogram that can be written and read from any thread without taking a lock.
+ * Buckets are log spaced (four per octave) starting at 50us, so the resolution stays around 20% from
+ * sub-millisecond samples up to several seconds. Percentiles are interpolated inside their bucket.
+ */
+class MOBILEWIDGETSWIPE_API FSwipeLatencyHistogram
+{
+public:
+	static constexpr int32 NumBuckets = 64;
+
+	FSwipeLatencyHistogram();
+
+	/** Records one sample, in seconds. */
+	void AddSample(double InSeconds);
+
+	/**
+	 * @param InPercentile in [0, 100], e.g. 50, 95 or 99.
+	 * @return the estimated latency in milliseconds, 0 when no sample has been recorded.
+	 */
+	double GetPercentileMs(float InPercentile) const;
+
+	/** @return the number of samples recorded since the last reset. */
+	uint32 GetNumSamples() const;
+
+	/** Clears every bucket. Samples recorded concurrently with the reset may or may not be kept. */
+	void Reset();
+
+private:
+	static int32 GetBucketIndex(double InSeconds);
+	static double GetBucketLowerBoundMs(int32 InBucketIndex);
+
+	std::atomic<uint32> Buckets[NumBuckets];
+};
@@ -6,6 +6,7 @@
 #include "SlateTypesExtension.h"
 
 class FLazySingleton;
+class ISlateStyle;
 
 namespace UE::Slate::Private
 {
@@ -25,21 +26,24 @@ struct MOBILEWIDGETSWIPE_API FDefaultStyleCacheExtension
 		const FSwipeBoxStyle& GetSwipeBoxStyle() const { return SwipeBoxStyle; };
 		const FSwipeBarStyle& GetSwipeBarStyle() const { return SwipeBarStyle; };
 
-
 	private:
 		friend FDefaultStyleCacheExtension;
 
+		/** Copies the styles of InStyle the first time the set is requested. */
+		void Initialize(const ISlateStyle& InStyle);
+
 		FSwipeBoxStyle SwipeBoxStyle;
 		FSwipeBarStyle SwipeBarStyle;
+		bool bInitialized = false;
 
 		TMap<UScriptStruct*, FSlateWidgetStyle*> TypeInstanceMap;
 	};
 
-	/** Gets singleton and returns runtime styles from singleton */
-	static const FStyles& GetRuntime() { return Get().Runtime; }
+	/** Gets singleton and returns runtime styles from singleton, copied on the first call */
+	static const FStyles& GetRuntime();
 #if WITH_EDITOR
-	/** Gets singleton and returns editor styles from singleton */
-	static const FStyles& GetEditor() { return Get().Editor; }
+	/** Gets singleton and returns editor styles from singleton, copied on the first call */
+	static const FStyles& GetEditor();
 #endif
 
 private:
@@ -6,6 +6,7 @@
 #include "Layout/Visibility.h"
 #include "SlotBase.h"
 #include "Layout/Geometry.h"
+#include "Layout/ArrangedChildren.h"
 #include "Styling/SlateColor.h"
 #include "Input/CursorReply.h"
 #include "Input/Reply.h"
@@ -22,6 +23,7 @@
 #include "Framework/Layout/InertialScrollManager.h"
 #include "Framework/Layout/OverScroll.h"
 #include "Slate/Framework/Layout/Stickyswipe.h"
+#include "Slate/Framework/Profiling/SwipeLatencyHistogram.h"
 #include "Slate/Styling/SlateTypesExtension.h"
 
 // #include "SSwipeBox.generated.h"
@@ -30,6 +32,9 @@ class FPaintArgs;
 class FSlateWindowElementList;
 class SSwipePanel;
 
+/** Called with the index of a page entering or leaving the view of a SSwipeBox. */
+DECLARE_DELEGATE_OneParam(FOnSwipePageLifecycle, int32 /*PageIndex*/);
+
 /** Where to Swipe the descendant to */
 // UENUM(BlueprintType)
 // enum class EDescendantSwipeDestination : uint8
@@ -79,6 +84,8 @@ public:
 	public:
 		SLATE_SLOT_BEGIN_ARGS(FSlot, TBasicLayoutWidgetSlot<FSlot>)
 			SLATE_ARGUMENT(TOptional<FSizeParam>, SizeParam)
+			/** Optional stable identity of the page, used by SSwipeBox::SyncSlots. */
+			SLATE_ARGUMENT(FName, Key)
 			TAttribute<float> _MaxSize;
 
 			/** The widget's DesiredSize will be used as the space required. */
@@ -159,7 +166,18 @@ public:
 			MaxSize.Assign(*this, MoveTemp(InMaxSize));
 		}
 
+		/** Get the stable identity of the page, NAME_None if the slot is not keyed. */
+		FName GetKey() const
+		{
+			return Key;
+		}
+
 	private:
+		friend class SSwipePanel;
+
+		/** Stable identity of the page, only the panel changes it so its key index stays valid. */
+		FName Key;
+
 		/**
 		 * How much space this slot should occupy along SwipeBox's direction.
 		 * When SizeRule is SizeRule_Auto, the widget's DesiredSize will be used as the space required.
@@ -200,6 +218,8 @@ public:
 			  , _SwipeWhenFocusChanges(EScrollWhenFocusChanges::NoScroll)
 			  , _OnUserSwipeed()
 			  , _ConsumeMouseWheel(EConsumeMouseWheel::WhenScrollingPossible)
+			  , _SuspendOffscreenPages(false)
+			  , _SuspendPageHitTestWhileSwiping(false)
 		{
 			_Clipping = EWidgetClipping::ClipToBounds;
 		}
@@ -266,9 +286,28 @@ public:
 
 		SLATE_ARGUMENT(EConsumeMouseWheel, ConsumeMouseWheel);
 
+		/** Stop arranging the pages outside the view, see SetSuspendOffscreenPages */
+		SLATE_ARGUMENT(bool, SuspendOffscreenPages);
+
+		/** Leave the pages out of hit testing while the user drags, see SetSuspendPageHitTestWhileSwiping */
+		SLATE_ARGUMENT(bool, SuspendPageHitTestWhileSwiping);
+
+		/** Called when the swipe offset of the next layout brings a page into the view */
+		SLATE_EVENT(FOnSwipePageLifecycle, OnPageWillAppear)
+
+		/** Called once a page has been laid out in the view */
+		SLATE_EVENT(FOnSwipePageLifecycle, OnPageDidAppear)
+
+		/** Called once a page that appeared, or was about to, is out of the view */
+		SLATE_EVENT(FOnSwipePageLifecycle, OnPageDidDisappear)
+
 	SLATE_END_ARGS()
 
 	SSwipeBox();
+	virtual ~SSwipeBox() override;
+
+	/** Calls InFunction for every SSwipeBox currently alive. Game thread only. */
+	static void ForEachLiveInstance(TFunctionRef<void(SSwipeBox&)> InFunction);
 
 	/** @return a new slot. Slots contain children for SSwipeBox */
 	static FSlot::FSlotArguments Slot();
@@ -279,12 +318,55 @@ public:
 	/** Adds a slot to SSwipeBox */
 	FScopedWidgetSlotArguments AddSlot();
 
+	/** Adds a slot built from InSlotArguments to SSwipeBox */
+	void AddSlot(FSlot::FSlotArguments&& InSlotArguments);
+
+	/** Adds every slot at the end of the box, with a single insertion and layout invalidation. */
+	void AddSlots(TArray<FSlot::FSlotArguments> InSlots);
+
 	/** Removes a slot at the specified location */
 	void RemoveSlot(const TSharedRef<SWidget>& WidgetToRemove);
 
+	/** Removes the slots holding WidgetsToRemove with a single layout invalidation. @return the number of slots removed. */
+	int32 RemoveSlots(TConstArrayView<TSharedRef<SWidget>> WidgetsToRemove);
+
+	/** Replaces every slot of the box by InSlots, with a single layout invalidation. */
+	void ReplaceSlots(TArray<FSlot::FSlotArguments> InSlots);
+
+	/**
+	 * Makes the slots of the box match InKeys, in order, touching only what changed: slots whose key is not in
+	 * InKeys are removed, slots with a known key are kept and moved, and InMakeSlot is only called for the new keys.
+	 * Slots without a key cannot be matched and are always removed (with a warning), so a box that is synced should
+	 * only ever get keyed slots. The current page is re-anchored by key so the visible page does not jump when
+	 * pages are inserted or removed before it. Keys must be unique and not NAME_None, otherwise a warning is logged
+	 * and the slots are left as they are. Slots sharing a key keep only the first of them.
+	 */
+	void SyncSlots(TConstArrayView<FName> InKeys, TFunctionRef<FSlot::FSlotArguments(FName InKey, int32 InSlotIndex)> InMakeSlot);
+
+	/** @return the index of the slot with the key InKey, INDEX_NONE if there is none. */
+	int32 FindSlotIndexByKey(FName InKey) const;
+
+	/**
+	 * Puts InNewContent in the slot holding InOldContent, keeping the slot and its page index. Use this rather
+	 * than attaching to the slot directly. @return false when InOldContent is not the content of a slot.
+	 */
+	bool ReplaceSlotContent(const SWidget& InOldContent, const TSharedRef<SWidget>& InNewContent);
+
 	/** Removes all children from the box */
 	void ClearChildren();
 
+	/** @return the number of slots (pages) in the box */
+	int32 GetNumSlots() const;
+
+	/** @return the number of slots whose content has actually been built (neither the null widget nor a placeholder) */
+	int32 GetNumRealizedPages() const;
+
+	/** @return a new empty widget holding the place of a page whose content is built later. */
+	static TSharedRef<SWidget> MakePagePlaceholder();
+
+	/** @return true when InWidget was made by MakePagePlaceholder. */
+	static bool IsPagePlaceholder(const SWidget& InWidget);
+
 	/** @return Returns true if the user is currently interactively Swipeing the view by holding
 		        the right mouse button and dragging. */
 	bool IsRightClickSwipeing() const;
@@ -311,6 +393,9 @@ public:
 
 	int GetCurrentPage() const;
 
+	/** @return the page on screen, the fraction being the progress of the swipe toward the next page. */
+	float GetPagePosition() const;
+
 	void SetCurrentPage(int NewPage);
 	
 	/**
@@ -386,10 +471,65 @@ public:
 
 	void SetSwipeBarStyle(const FSwipeBarStyle* InBarStyle);
 
+	const FSwipeBoxStyle* GetStyle() const { return Style; }
+
+	const FSwipeBarStyle* GetSwipeBarStyle() const { return SwipeBarStyle; }
+
 	void InvalidateStyle();
 
 	void InvalidateSwipeBarStyle();
 
+	/**
+	 * Delay between a touch move and the first layout pass that arranges the pages at the resulting offset.
+	 * Safe to read from any thread.
+	 */
+	const FSwipeLatencyHistogram& GetInputLatency() const;
+
+	/** Clears the input latency samples recorded so far. */
+	void ResetInputLatency();
+
+	/**
+	 * Forgets the cached keyboard focusable widget of a page, or of every page with INDEX_NONE.
+	 * Adding or removing slots does it automatically. Call it after adding focusable widgets to a page that had
+	 * none, or after making a hidden part of a page visible again.
+	 */
+	void InvalidateKeyboardFocusCache(int32 PageIndex = INDEX_NONE);
+
+	/**
+	 * When set, pages outside the view keep their space but are not arranged, so they are neither ticked, painted
+	 * nor hit tested. Their visibility and desired size are still queried to lay out the pages in view, so bindings
+	 * of those run as usual. They cannot take focus until they come into view.
+	 */
+	void SetSuspendOffscreenPages(bool bInSuspendOffscreenPages);
+
+	bool IsSuspendOffscreenPages() const
+	{
+		return bSuspendOffscreenPages;
+	}
+
+	/** @return the pages laid out in the view by the last layout pass, empty before the first one. */
+	FInt32Interval GetPagesInView() const;
+
+	/**
+	 * When set, the pages are left out of the hit test grid from the moment a touch drag is captured until the
+	 * pages settle, so the moving finger neither hit tests nor hovers their content.
+	 */
+	void SetSuspendPageHitTestWhileSwiping(bool bInSuspendPageHitTestWhileSwiping);
+
+	bool IsSuspendPageHitTestWhileSwiping() const
+	{
+		return bSuspendPageHitTestWhileSwiping;
+	}
+
+	/**
+	 * Lets touch events drag the box without it holding the mouse capture, so a commandlet can feed it synthetic
+	 * touches outside of a window. Never set it on a box shown to the user.
+	 */
+	void SetAssumeTouchCaptureForTesting(bool bInAssumeTouchCapture)
+	{
+		bAssumeTouchCaptureForTesting = bInAssumeTouchCapture;
+	}
+
 public:
 	// SWidget interface
 	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
@@ -432,6 +572,22 @@ private:
 		return float(Orientation == Orient_Vertical ? Vector.Y : Vector.X);
 	}
 
+	/** Geometry of the Swipe panel within InMyGeometry, found without allocating once the first search sized the buffer. */
+	FGeometry GetSwipePanelGeometry(const FGeometry& InMyGeometry) const;
+
+	/**
+	 * Finds the geometry of InDescendant by arranging only its ancestors, reusing the buffer of GetSwipePanelGeometry.
+	 * @return false when InDescendant is not an arranged descendant of this box.
+	 */
+	bool FindDescendantGeometry(const FGeometry& InMyGeometry, const SWidget& InDescendant, FGeometry& OutGeometry) const;
+
+	/** Gets the length of the pages in the direction of Swiping when the panel is laid out in InSwipePanelGeometry. */
+	double GetContentSize(const FGeometry& InSwipePanelGeometry) const;
+
+	/** GetViewFraction and GetViewOffsetFraction for a content size the caller already has. */
+	float GetViewFraction(const FGeometry& InSwipePanelGeometry, double InContentSize) const;
+	float GetViewOffsetFraction(const FGeometry& InSwipePanelGeometry, double InContentSize) const;
+
 	/** Sets the component of a vector in the direction of Swipeing based on the Orientation property. */
 	inline void SetSwipeComponentOnVector(FVector2f& InVector, float Value) const
 	{
@@ -476,6 +632,9 @@ private:
 
 	void BeginInertialSwipeing();
 
+	/** Sends the page lifecycle events and picks the pages the next layout arranges, call once the panel offset is final. */
+	void UpdatePageLifecycle();
+
 	/** Padding to the SwipeBox */
 	FMargin SwipeBarSlotPadding;
 
@@ -493,9 +652,49 @@ protected:
 	                                     EDescendantScrollDestination InDestination =
 		                                     EDescendantScrollDestination::IntoView, float Padding = 0);
 
+	/** Snaps to the page holding WidgetToFind using the page index, @return false if it is not a descendant. */
+	bool SwipePageOfDescendantIntoView(const SWidget& WidgetToFind, bool InAnimateSwipe);
+
 	/** returns widget that can receive keyboard focus or nullprt **/
 	TSharedPtr<SWidget> GetKeyboardFocusableWidget(TSharedPtr<SWidget> InWidget);
 
+	/** Cached GetKeyboardFocusableWidget for one page, revalidated without searching the page again when possible. */
+	TSharedPtr<SWidget> GetPageKeyboardFocusableWidget(int32 PageIndex);
+
+	/** @return the first focusable widget of the pages after FromPageIndex in Direction (1 or -1), skipping known unfocusable runs. */
+	TSharedPtr<SWidget> FindNextKeyboardFocusableWidget(int32 FromPageIndex, int32 Direction);
+
+	/** @return true if InFocusable still supports focus and every widget up to InPage is visible. */
+	bool IsCachedFocusableStillValid(const SWidget& InFocusable, const SWidget& InPage) const;
+
+	/** Keyboard focus search result of one page. */
+	struct FFocusCacheEntry
+	{
+		/** First focusable widget of the page, in GetKeyboardFocusableWidget order. */
+		TWeakPtr<SWidget> Focusable;
+
+		/** Page content and visibility the entry was computed for. */
+		const SWidget* Page = nullptr;
+		EVisibility PageVisibility;
+
+		/** Matches FocusCacheGeneration when the entry is valid, 0 when never computed. */
+		uint32 Generation = 0;
+		bool bHasFocusable = false;
+
+		/** For unfocusable pages, the next page worth searching backward [0] and forward [1], valid when SkipGeneration matches FocusSkipGeneration. */
+		int32 SkipTo[2] = {INDEX_NONE, INDEX_NONE};
+		uint32 SkipGeneration[2] = {0, 0};
+	};
+
+	/** One entry per slot, grown lazily. */
+	TArray<FFocusCacheEntry> FocusCache;
+
+	/** Bumped to invalidate every FocusCache entry. */
+	uint32 FocusCacheGeneration = 1;
+
+	/** Bumped whenever any page changes, which invalidates every skip pointer. */
+	uint32 FocusSkipGeneration = 1;
+
 	/** The panel which stacks the child slots */
 	TSharedPtr<class SSwipePanel> SwipePanel;
 
@@ -562,6 +761,17 @@ protected:
 	/** Fired when the user Swipes the SwipeBox */
 	FOnUserSwipeed OnUserSwipeed;
 
+	/** Page lifecycle events, see the matching arguments. */
+	FOnSwipePageLifecycle OnPageWillAppear;
+	FOnSwipePageLifecycle OnPageDidAppear;
+	FOnSwipePageLifecycle OnPageDidDisappear;
+
+	/** Pages announced by OnPageWillAppear that were not laid out in the view yet. */
+	TArray<TWeakPtr<SWidget>> AppearingPages;
+
+	/** Pages announced by OnPageDidAppear that are still in the view. */
+	TArray<TWeakPtr<SWidget>> AppearedPages;
+
 	/** The Swipeing and stacking orientation. */
 	EOrientation Orientation;
 
@@ -584,6 +794,25 @@ protected:
 
 	double LastSwipeTime;
 
+	/** Time of the oldest touch move whose offset has not been handed to the panel yet, 0 if none. */
+	double PendingInputTime;
+
+#if WITH_SLATE_DEBUGGING
+	/** Values shown by the SwipeBox.DebugOverlay console variable. */
+	struct FDebugOverlayState
+	{
+		double LastMoveTime = 0.0;
+		float DragVelocity = 0.f;
+		float ReleaseVelocity = 0.f;
+		double TickMs = 0.0;
+		double PaintMs = 0.0;
+	};
+	mutable FDebugOverlayState DebugOverlay;
+
+	/** Draws page boundaries, the sticky swipe state and timings on top of the box. */
+	int32 PaintDebugOverlay(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const;
+#endif
+
 	/** Multiplier applied to each click of the Swipe wheel (applied alongside the global Swipe amount) */
 	float WheelSwipeMultiplier = 1.f;
 
@@ -611,6 +840,18 @@ protected:
 	bool bAllowsRightClickDragSwipeing : 1;
 
 	bool bTouchPanningCapture : 1;
+
+	/** Whether the pages outside the view are left out of the layout */
+	bool bSuspendOffscreenPages : 1;
+
+	/** Whether the pages are left out of the hit test grid during a touch swipe */
+	bool bSuspendPageHitTestWhileSwiping : 1;
+
+	/** See SetAssumeTouchCaptureForTesting */
+	bool bAssumeTouchCaptureForTesting : 1;
+
+	/** Reused by GetSwipePanelGeometry, so finding the panel every frame does not allocate. Empty between calls. */
+	mutable FArrangedChildren PanelPathArrangedChildren;
 };
 
 class MOBILEWIDGETSWIPE_API SSwipePanel : public SPanel
@@ -647,166 +888,262 @@ public:
 	void SetOrientation(EOrientation InOrientation)
 	{
 		Orientation = InOrientation;
+		bContentExtentDirty = true;
 	}
 
 	virtual void
 	OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
 
+	/**
+	 * Layout inputs of the children of a stack, one array per input so the layout passes read them contiguously
+	 * instead of going through every slot and widget again. Refilled from the slots at the start of a pass, since the
+	 * desired size and visibility of a child can change on any prepass. The arrays keep their capacity.
+	 */
+	struct FStackLayoutInputs
+	{
+		TArray<EVisibility> Visibilities;
+		TArray<FVector2f> DesiredSizes;
+		/** Slot paddings, left and right already swapped for the flow direction. */
+		TArray<FMargin> Paddings;
+		TArray<FSizeParam::ESizeRule> SizeRules;
+		TArray<float> SizeValues;
+		/** 0 when the slot has no max size. */
+		TArray<float> MaxSizes;
+
+		/** Desired size and padding along the stack. */
+		TArray<float> SizesAlong;
+		TArray<float> PaddingsAlong;
+		/** 1 for stretch slots and visible children, 0 otherwise, as floats for the vectorized spans. */
+		TArray<float> StretchFlags;
+		TArray<float> VisibleFlags;
+
+		/** Written by ComputeChildSpans: length of every slot along the stack and where it starts. */
+		TArray<float> Extents;
+		TArray<double> Starts;
+
+		int32 Num() const
+		{
+			return Visibilities.Num();
+		}
+
+		bool IsCollapsed(int32 ChildIndex) const
+		{
+			return Visibilities[ChildIndex] == EVisibility::Collapsed;
+		}
+
+		/** Reads the layout inputs of every slot of Children, visiting each slot and widget once. */
+		template <EOrientation Orientation, typename SlotType>
+		void Gather(const TPanelChildren<SlotType>& Children, EFlowDirection InLayoutFlow)
+		{
+			const int32 NumChildren = Children.Num();
+			Visibilities.SetNumUninitialized(NumChildren, false);
+			DesiredSizes.SetNumUninitialized(NumChildren, false);
+			Paddings.SetNumUninitialized(NumChildren, false);
+			SizeRules.SetNumUninitialized(NumChildren, false);
+			SizeValues.SetNumUninitialized(NumChildren, false);
+			MaxSizes.SetNumUninitialized(NumChildren, false);
+			SizesAlong.SetNumUninitialized(NumChildren, false);
+			PaddingsAlong.SetNumUninitialized(NumChildren, false);
+			StretchFlags.SetNumUninitialized(NumChildren, false);
+			VisibleFlags.SetNumUninitialized(NumChildren, false);
+
+			for (int32 ChildIndex = 0; ChildIndex < NumChildren; ++ChildIndex)
+			{
+				const SlotType& CurChild = Children[ChildIndex];
+				const SWidget& ChildWidget = CurChild.GetWidget().Get();
+				Visibilities[ChildIndex] = ChildWidget.GetVisibility();
+				DesiredSizes[ChildIndex] = ChildWidget.GetDesiredSize();
+				Paddings[ChildIndex] = LayoutPaddingWithFlow(InLayoutFlow, CurChild.GetPadding());
+				SizeRules[ChildIndex] = CurChild.GetSizeRule();
+				SizeValues[ChildIndex] = CurChild.GetSizeValue();
+				MaxSizes[ChildIndex] = CurChild.GetMaxSize();
+
+				SizesAlong[ChildIndex] = (Orientation == Orient_Vertical)
+					                         ? DesiredSizes[ChildIndex].Y
+					                         : DesiredSizes[ChildIndex].X;
+				PaddingsAlong[ChildIndex] = Paddings[ChildIndex].template GetTotalSpaceAlong<Orientation>();
+				StretchFlags[ChildIndex] = SizeRules[ChildIndex] == FSizeParam::SizeRule_Stretch ? 1.0f : 0.0f;
+				VisibleFlags[ChildIndex] = IsCollapsed(ChildIndex) ? 0.0f : 1.0f;
+			}
+		}
+	};
+
+	/** Space taken by the fixed size children and stretch coefficients of the others, gathered before arranging a stack. */
+	struct FStackTotals
+	{
+		float StretchCoefficientTotal = 0.0f;
+		float FixedTotal = 0.0f;
+		float StretchSizeTotal = 0.0f;
+		bool bAnyChildVisible = false;
+	};
+
+	/** Sums the space requirements of the children along the stack when it is given InAllottedSize. */
+	static FStackTotals ComputeStackTotals(const FStackLayoutInputs& Inputs, float InAllottedSize,
+	                                       bool InSlotStretchChildAsParentSize);
+
+	/** @return the space shared by the stretch children of a stack given InAllottedSize. */
+	static float ComputeNonFixedSpace(const FStackTotals& InTotals, float InAllottedSize, bool InAllowShrink)
+	{
+		//When shrink is not allowed, we'll ensure to use all the space desired by the stretchable widgets.
+		const float MinSize = InAllowShrink ? 0.0f : InTotals.StretchSizeTotal;
+
+		// The space available for SizeRule_Stretch widgets is any space that wasn't taken up by fixed-sized widgets.
+		return FMath::Max(MinSize, InAllottedSize - InTotals.FixedTotal);
+	}
+
+	/** @return the size of the child ChildIndex along the stack, margin excluded, 0 when it is collapsed. */
+	static float ComputeChildSizeAlong(const FStackLayoutInputs& Inputs, int32 ChildIndex, float InNonFixedSpace,
+	                                   float InStretchCoefficientTotal)
+	{
+		if (Inputs.IsCollapsed(ChildIndex))
+		{
+			return 0.0f;
+		}
+
+		float ChildSize = 0.0f;
+		// The size of the widget depends on its size type
+		if (Inputs.SizeRules[ChildIndex] == FSizeParam::SizeRule_Stretch)
+		{
+			if (InStretchCoefficientTotal > 0.0f)
+			{
+				// Stretch widgets get a fraction of the space remaining after all the fixed-space requirements are met
+				ChildSize = InNonFixedSpace * Inputs.SizeValues[ChildIndex] / InStretchCoefficientTotal;
+			}
+		}
+		else
+		{
+			// Auto-sized widgets get their desired-size value
+			ChildSize = Inputs.SizesAlong[ChildIndex];
+		}
+
+		// Clamp to the max size if it was specified
+		const float MaxSize = Inputs.MaxSizes[ChildIndex];
+		if (MaxSize > 0.0f)
+		{
+			ChildSize = FMath::Min(MaxSize, ChildSize);
+		}
+		return ChildSize;
+	}
+
+	/** Below this many children ComputeChildSpans is not worth vectorizing. */
+	static constexpr int32 MinChildrenToVectorizeSpans = 32;
+
+	/**
+	 * Fills Inputs.Extents with the length of every slot along the stack, padding included unless the pages are
+	 * stretched as the parent and 0 for collapsed children, and Inputs.Starts with where every slot starts when they
+	 * are laid out from the first child, or from the last one when bInReverse.
+	 * The vectorized path computes four extents at once and their positions with an in-register prefix sum, the
+	 * running total stays in double. Its positions can differ from the scalar ones by a float rounding.
+	 * @return the length of the whole stack.
+	 */
+	static double ComputeChildSpans(FStackLayoutInputs& Inputs, float InNonFixedSpace, float InStretchCoefficientTotal,
+	                                bool InSlotStretchChildAsParentSize, bool bInReverse, bool bInVectorized);
+
+	/**
+	 * @return the length of the stack once arranged in InAllottedSize, the same layout as
+	 *         ArrangeChildrenInStackOverride without producing any geometry.
+	 */
+	static double ComputeStackExtent(FStackLayoutInputs& Inputs, float InAllottedSize, bool InAllowShrink,
+	                                 bool InSlotStretchChildAsParentSize);
+
+	/**
+	 * Arranges Children one after the other along Orientation. The layout inputs of the children are gathered into
+	 * InOutLayoutInputs first, pass the same arrays every frame so they do not need to grow again.
+	 */
 	template <EOrientation Orientation, typename SlotType>
 	static void ArrangeChildrenInStackOverride(EFlowDirection InLayoutFlow, const TPanelChildren<SlotType>& Children,
 	                                           const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren,
-	                                           float InOffset, bool InAllowShrink, bool InSlotStretchChildAsParentSize)
+	                                           double InOffset, bool InAllowShrink, bool InSlotStretchChildAsParentSize,
+	                                           FStackLayoutInputs& InOutLayoutInputs,
+	                                           TArray<FVector2d>* OutPageSpans = nullptr,
+	                                           const FInt32Interval* InArrangedPages = nullptr)
 	{
 		// Allotted space will be given to fixed-size children first.
 		// Remaining space will be proportionately divided between stretch children (SizeRule_Stretch)
 		// based on their stretch coefficient
 
-		if (Children.Num() > 0)
+		if (OutPageSpans)
 		{
-			float StretchCoefficientTotal = 0.0f;
-			float FixedTotal = 0.0f;
-			float StretchSizeTotal = 0.0f;
-
-			bool bAnyChildVisible = false;
-			// Compute the sum of stretch coefficients (SizeRule_Stretch) and space required by fixed-size widgets (SizeRule_Auto),
-			// as well as the total desired size.
-			for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
-			{
-				const SlotType& CurChild = Children[ChildIndex];
-
-				if (CurChild.GetWidget()->GetVisibility() != EVisibility::Collapsed)
-				{
-					bAnyChildVisible = true;
-					// All widgets contribute their margin to the fixed space requirement
-					// UE_LOG(LogTemp, Warning, TEXT("FixedTotal: %f +=: %f"), FixedTotal, CurChild.GetPadding().template GetTotalSpaceAlong<Orientation>())
-					FixedTotal += CurChild.GetPadding().template GetTotalSpaceAlong<Orientation>();
-
-
-					FVector2f ChildDesiredSize = CurChild.GetWidget()->GetDesiredSize();
-
-					// Auto-sized children contribute their desired size to the fixed space requirement
-					const float ChildSize = (Orientation == Orient_Vertical)
-						                        ? ChildDesiredSize.Y
-						                        : ChildDesiredSize.X;
-
-					if (CurChild.GetSizeRule() == FSizeParam::SizeRule_Stretch)
-					{
-						if (InSlotStretchChildAsParentSize)
-						{
-							const float TotalSize = (Orientation == Orient_Vertical)
-												? AllottedGeometry.GetLocalSize().Y
-												: AllottedGeometry.GetLocalSize().X;
-							// for stretch children we save sum up the stretch coefficients
-							StretchCoefficientTotal += CurChild.GetSizeValue();
-							StretchSizeTotal += TotalSize;
-						}
-						else
-						{
-							// for stretch children we save sum up the stretch coefficients
-							StretchCoefficientTotal += CurChild.GetSizeValue();
-							StretchSizeTotal += ChildSize;
-						}
-					}
-					else
-					{
-						// Clamp to the max size if it was specified
-						float MaxSize = CurChild.GetMaxSize();
-						FixedTotal += MaxSize > 0.0f ? FMath::Min(MaxSize, ChildSize) : ChildSize;
-					}
-				}
-			}
+			OutPageSpans->Reset();
+			OutPageSpans->SetNumZeroed(Children.Num());
+		}
 
-			if (!bAnyChildVisible)
+		if (Children.Num() > 0)
+		{
+			FStackLayoutInputs& Inputs = InOutLayoutInputs;
+			Inputs.Gather<Orientation>(Children, InLayoutFlow);
+
+			const float AllottedSize = (Orientation == Orient_Vertical)
+				                           ? AllottedGeometry.GetLocalSize().Y
+				                           : AllottedGeometry.GetLocalSize().X;
+			const FStackTotals Totals = ComputeStackTotals(Inputs, AllottedSize, InSlotStretchChildAsParentSize);
+			if (!Totals.bAnyChildVisible)
 			{
 				return;
 			}
 
-			//When shrink is not allowed, we'll ensure to use all the space desired by the stretchable widgets.
-			const float MinSize = InAllowShrink ? 0.0f : StretchSizeTotal;
-
-			// The space available for SizeRule_Stretch widgets is any space that wasn't taken up by fixed-sized widgets.
-			const float NonFixedSpace = FMath::Max(MinSize, (Orientation == Orient_Vertical)
-				                                                ? AllottedGeometry.GetLocalSize().Y - FixedTotal
-				                                                : AllottedGeometry.GetLocalSize().X - FixedTotal);
-
-			// UE_LOG(LogTemp, Warning, TEXT("MinSize: %f , AllottedGeometry.GetLocalSize().X: %f, FixedTotal: %f"), MinSize, AllottedGeometry.GetLocalSize().X, FixedTotal)
-			float PositionSoFar = 0.0f;
+			const float NonFixedSpace = ComputeNonFixedSpace(Totals, AllottedSize, InAllowShrink);
 
 			// Now that we have the total fixed-space requirement and the total stretch coefficients we can
-			// arrange widgets top-to-bottom or left-to-right (depending on the orientation).
-			for (TPanelChildrenConstIterator<SlotType> It(Children, Orientation, InLayoutFlow); It; ++It)
+			// arrange widgets top-to-bottom or left-to-right (depending on the orientation), in the order
+			// TPanelChildrenConstIterator would visit them.
+			// Positions are accumulated in double from the first page and offset before narrowing, so the pages
+			// around the view keep exact coordinates however many pages come before them.
+			const bool bReverseOrder = Orientation == Orient_Horizontal && InLayoutFlow == EFlowDirection::RightToLeft;
+			const int32 NumChildren = Inputs.Num();
+			ComputeChildSpans(Inputs, NonFixedSpace, Totals.StretchCoefficientTotal, InSlotStretchChildAsParentSize,
+			                  bReverseOrder, NumChildren >= MinChildrenToVectorizeSpans);
+
+			for (int32 Step = 0; Step < NumChildren; ++Step)
 			{
-				const SlotType& CurChild = *It;
-				const EVisibility ChildVisibility = CurChild.GetWidget()->GetVisibility();
-
-				// Figure out the area allocated to the child in the direction of BoxPanel
-				// The area allocated to the slot is ChildSize + the associated margin.
-				float ChildSize = 0.0f;
-				if (ChildVisibility != EVisibility::Collapsed)
+				const int32 ChildIndex = bReverseOrder ? NumChildren - 1 - Step : Step;
+				const double SlotStart = Inputs.Starts[ChildIndex];
+				if (OutPageSpans)
 				{
-					// The size of the widget depends on its size type
-					if (CurChild.GetSizeRule() == FSizeParam::SizeRule_Stretch)
-					{
-						// UE_LOG(LogTemp, Warning, TEXT("ChildSize: %f * %f / %f"), NonFixedSpace, CurChild.GetSizeValue(), StretchCoefficientTotal)
-						// if (InSlotStretchChildAsParentSize)
-						// {
-						// 	ChildSize = NonFixedSpace;// * CurChild.GetSizeValue();
-						// }
-						// else
-						// {
-							if (StretchCoefficientTotal > 0.0f)
-							{
-								// Stretch widgets get a fraction of the space remaining after all the fixed-space requirements are met
-								ChildSize = NonFixedSpace * CurChild.GetSizeValue() / StretchCoefficientTotal;
-							}
-						// }
-					}
-					else
-					{
-						const FVector2f ChildDesiredSize = CurChild.GetWidget()->GetDesiredSize();
-
-						// Auto-sized widgets get their desired-size value
-						ChildSize = (Orientation == Orient_Vertical)
-							            ? ChildDesiredSize.Y
-							            : ChildDesiredSize.X;
-					}
-
-					// Clamp to the max size if it was specified
-					float MaxSize = CurChild.GetMaxSize();
-					if (MaxSize > 0.0f)
-					{
-						ChildSize = FMath::Min(MaxSize, ChildSize);
-					}
+					(*OutPageSpans)[ChildIndex] = FVector2d(SlotStart, SlotStart + Inputs.Extents[ChildIndex]);
 				}
 
-				const FMargin SlotPadding(LayoutPaddingWithFlow(InLayoutFlow, CurChild.GetPadding()));
-
-				FVector2f SlotSize = (Orientation == Orient_Vertical)
-					                     ? FVector2f(AllottedGeometry.GetLocalSize().X,
-					                                 ChildSize +
-					                                 (InSlotStretchChildAsParentSize?0: SlotPadding.template GetTotalSpaceAlong<Orient_Vertical>())
-					                                 )
-					                     : FVector2f(
-						                     ChildSize +
-						                     (InSlotStretchChildAsParentSize?0: SlotPadding.template GetTotalSpaceAlong<Orient_Horizontal>()),
-						                     AllottedGeometry.GetLocalSize().Y);
+				// Pages outside InArrangedPages keep their space but are left out of the arranged children, only the
+				// arranged ones reach back to their slot.
+				if (InArrangedPages && !InArrangedPages->Contains(ChildIndex))
+				{
+					continue;
+				}
 
-				// Figure out the size and local position of the child within the slot			
+				// Figure out the area allocated to the child in the direction of BoxPanel
+				// The area allocated to the slot is ChildSize + the associated margin.
+				const float ChildSize = ComputeChildSizeAlong(Inputs, ChildIndex, NonFixedSpace,
+				                                              Totals.StretchCoefficientTotal);
+				const FMargin& SlotPadding = Inputs.Paddings[ChildIndex];
+				const float SlotSizeAlong = ChildSize + (InSlotStretchChildAsParentSize
+					                                         ? 0.0f
+					                                         : Inputs.PaddingsAlong[ChildIndex]);
+				const float SlotSizeAcross = (Orientation == Orient_Vertical)
+					                             ? AllottedGeometry.GetLocalSize().X
+					                             : AllottedGeometry.GetLocalSize().Y;
+				const FVector2f SlotSize = (Orientation == Orient_Vertical)
+					                           ? FVector2f(SlotSizeAcross, SlotSizeAlong)
+					                           : FVector2f(SlotSizeAlong, SlotSizeAcross);
+
+				// Figure out the size and local position of the child within the slot
+				const SlotType& CurChild = Children[ChildIndex];
+				const FVector2f& ChildDesiredSize = Inputs.DesiredSizes[ChildIndex];
 				AlignmentArrangeResult XAlignmentResult = AlignChild<Orient_Horizontal>(
-					InLayoutFlow, SlotSize.X, CurChild, SlotPadding);
-				AlignmentArrangeResult YAlignmentResult = AlignChild<
-					Orient_Vertical>(SlotSize.Y, CurChild, SlotPadding);
+					InLayoutFlow, SlotSize.X, ChildDesiredSize.X, CurChild, SlotPadding);
+				AlignmentArrangeResult YAlignmentResult = AlignChild<Orient_Vertical>(
+					SlotSize.Y, ChildDesiredSize.Y, CurChild, SlotPadding);
 
+				const float PositionInView = static_cast<float>(SlotStart + InOffset);
 				const FVector2f LocalPosition = (Orientation == Orient_Vertical)
 					                                ? FVector2f(XAlignmentResult.Offset,
-					                                            PositionSoFar + YAlignmentResult.Offset + InOffset)
-					                                : FVector2f(PositionSoFar + XAlignmentResult.Offset + InOffset,
+					                                            PositionInView + YAlignmentResult.Offset)
+					                                : FVector2f(PositionInView + XAlignmentResult.Offset,
 					                                            YAlignmentResult.Offset);
 
 				const FVector2f LocalSize = FVector2f(XAlignmentResult.Size, YAlignmentResult.Size);
 
 				// Add the information about this child to the output list (ArrangedChildren)
-				ArrangedChildren.AddWidget(ChildVisibility, AllottedGeometry.MakeChild(
+				ArrangedChildren.AddWidget(Inputs.Visibilities[ChildIndex], AllottedGeometry.MakeChild(
 					                           // The child widget being arranged
 					                           CurChild.GetWidget(),
 					                           // Child's local position (i.e. position within parent)
@@ -814,13 +1151,6 @@ public:
 					                           // Child's size
 					                           LocalSize
 				                           ));
-				// UE_LOG(LogTemp, Warning, TEXT("LocalPosition: x: %f, y: %f"), LocalPosition.X, LocalPosition.Y)
-				// UE_LOG(LogTemp, Warning, TEXT("PositionSoFar :%f + XAlignmentResult.Offset :%f + InOffset :%f"), PositionSoFar, XAlignmentResult.Offset, InOffset)
-				if (ChildVisibility != EVisibility::Collapsed)
-				{
-					// Offset the next child by the size of the current child and any post-child (bottom/right) margin
-					PositionSoFar += (Orientation == Orient_Vertical) ? SlotSize.Y : SlotSize.X;
-				}
 			}
 		}
 	}
@@ -830,15 +1160,137 @@ public:
 		return &Children;
 	}
 
-	float PhysicalOffset;
+	/**
+	 * @return the index of the page that is or contains InDescendant, INDEX_NONE if it is not in this panel.
+	 * Walks up the parents of InDescendant, the cost does not depend on the number of pages.
+	 */
+	int32 FindPageIndex(const SWidget& InDescendant) const;
+
+	/** Marks the page index of the slots from InFirstIndex onward out of date, call after inserting slots. */
+	void UpdatePageIndex(int32 InFirstIndex);
+
+	/** Appends a slot and keeps the page index up to date. */
+	void AddPage(SSwipeBox::FSlot::FSlotArguments&& InSlotArguments);
+
+	/** Appends every slot and keeps the page index up to date. */
+	void AddPages(TArray<SSwipeBox::FSlot::FSlotArguments> InSlots);
+
+	/** Removes the slot holding InWidget and keeps the page index up to date. @return the removed slot index or INDEX_NONE. */
+	int32 RemovePage(const TSharedRef<SWidget>& InWidget);
+
+	/** Removes the slots holding InWidgets, reindexing the remaining pages once. @return the number of slots removed. */
+	int32 RemovePages(TConstArrayView<TSharedRef<SWidget>> InWidgets);
+
+	/** Removes every slot. */
+	void ClearPages();
+
+	/**
+	 * Reorders, inserts and removes slots so their keys match InKeys, see SSwipeBox::SyncSlots.
+	 * @return false, leaving the slots untouched, when InKeys holds a duplicate or NAME_None.
+	 */
+	bool SyncPages(TConstArrayView<FName> InKeys, TFunctionRef<SSwipeBox::FSlot::FSlotArguments(FName, int32)> InMakePage);
+
+	/** @return the index of the slot with the key InKey, INDEX_NONE if there is none. */
+	int32 FindPageIndexByKey(FName InKey) const;
+
+	/** Attaches InContent to the slot InPageIndex and keeps the page index up to date. */
+	void SetPageContent(int32 InPageIndex, const TSharedRef<SWidget>& InContent);
+
+	double PhysicalOffset;
 	TPanelChildren<SSwipeBox::FSlot> Children;
 
+	/** Time of the touch move that produced PhysicalOffset, consumed by the next arrange pass. 0 if none. */
+	mutable double PendingInputTime = 0.0;
+
+	/** Touch move to arrange latency, filled by OnArrangeChildren. */
+	mutable FSwipeLatencyHistogram InputLatency;
+
+	/**
+	 * When set, the pages are painted without being added to the hit test grid. Read by the paint pass only, so the
+	 * change takes effect on the next repaint without invalidating anything.
+	 */
+	bool bPagesHitTestInvisible = false;
+
+	/** When set, only these pages are arranged, the others keep their space. See SSwipeBox::SetSuspendOffscreenPages. */
+	TOptional<FInt32Interval> ArrangedPages;
+
+	/**
+	 * @return the pages intersecting the view when the panel is at InPhysicalOffset, computed from the page
+	 *         extents of the last arrange pass. Empty when the pages changed since.
+	 */
+	FInt32Interval GetPagesInView(double InPhysicalOffset) const;
+
+	/**
+	 * @return the length of the pages along the orientation, swipe padding included, when the view is InViewExtent
+	 *         long. Derived from the view and the desired size of the pages only, it does not wait for a layout pass.
+	 *         Computed once per layout, until the pages, their desired size or InViewExtent change.
+	 */
+	double GetContentExtent(float InViewExtent) const;
+
+	/** PhysicalOffset used by the last arrange pass. */
+	double GetArrangedPhysicalOffset() const
+	{
+		return ArrangedPhysicalOffset;
+	}
+
+	/** Start and end of every page along the orientation, before the swipe offset, as of the last arrange pass. */
+	TConstArrayView<FVector2d> GetArrangedPageSpans() const
+	{
+		return PageSpans;
+	}
+
+	/** @return where the page spans start in the panel when it is at InPhysicalOffset, using the last view extent. */
+	double GetChildrenOffset(double InPhysicalOffset) const
+	{
+		return -InPhysicalOffset + (BackPadSwipeing ? ArrangedViewExtent : 0.f);
+	}
+
 protected:
 	// Begin SWidget overrides.
 	virtual FVector2D ComputeDesiredSize(float) const override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	                      FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+	                      bool bParentEnabled) const override;
 	// End SWidget overrides.
 
 private:
+	/** Indexes the slots from FirstUnindexedPage onward. */
+	void EnsurePageIndex() const;
+
+	/** Drops every entry and indexes all the slots again, used when a lookup hits an entry that does not match its slot. */
+	void RebuildPageIndex() const;
+
+	/**
+	 * Page index of the content widget of every slot, the null widget is not indexed. Kept up to date by the functions
+	 * above; content attached to a slot directly is found by rebuilding the index when a lookup misses it.
+	 */
+	mutable TMap<const SWidget*, int32> PageIndexByWidget;
+
+	/** Page index of every keyed slot. Entries of removed slots may linger, lookups check the key of the slot. */
+	mutable TMap<FName, int32> PageIndexByKey;
+
+	/** Scratch containers of SyncPages, kept so syncing does not allocate once they have grown. */
+	TMap<FName, int32> SyncKeyOrder;
+	TMap<FName, int32> SyncKeptPages;
+
+	/** First slot whose entries in the page index are out of date, MAX_int32 when the index is current. */
+	mutable int32 FirstUnindexedPage = 0;
+
+	/** Start and end of every page along the orientation, before the swipe offset, as of the last arrange pass. */
+	mutable TArray<FVector2d> PageSpans;
+
+	/** Layout inputs of the pages, refilled by every arrange pass and content extent query. */
+	mutable FStackLayoutInputs LayoutInputs;
+
+	/** Offset and view extent of the last arrange pass. */
+	mutable double ArrangedPhysicalOffset = 0.0;
+	mutable float ArrangedViewExtent = 0.f;
+
+	/** Result of the last GetContentExtent and the view extent it was computed for, recomputed once dirty. */
+	mutable double CachedContentExtent = 0.0;
+	mutable float CachedContentViewExtent = 0.f;
+	mutable bool bContentExtentDirty = true;
+
 	EOrientation Orientation;
 	bool SlotStretchChildAsParentSize;
 	bool BackPadSwipeing;
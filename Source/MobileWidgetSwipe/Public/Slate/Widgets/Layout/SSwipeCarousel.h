@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Layout/Children.h"
+#include "Slate/Framework/Layout/SwipePageDrag.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SPanel.h"
+
+/**
+ * Called to fill a page of the carousel.
+ * @param LogicalIndex The unbounded index of the page, negative when swiping backward from the start.
+ * @param RecycledPage The widget previously shown by the same ring slot, null the first time. Rebinding and
+ *                     returning it avoids creating a new widget for every page.
+ */
+DECLARE_DELEGATE_RetVal_TwoParams(TSharedRef<SWidget>, FOnGenerateCarouselPage, int64 /*LogicalIndex*/, TSharedPtr<SWidget> /*RecycledPage*/);
+
+DECLARE_DELEGATE_OneParam(FOnCarouselPageChanged, int64 /*LogicalIndex*/);
+
+/**
+ * A swipe panel that loops forever. Only the previous, current and next pages exist: they live in a ring of
+ * three slots that are rotated and rebound as the logical page index moves, so memory and layout cost stay
+ * the same however far the user swipes. Pages snap with the same easing settings as SSwipeBox.
+ */
+class MOBILEWIDGETSWIPE_API SSwipeCarousel : public SPanel
+{
+public:
+	SLATE_BEGIN_ARGS(SSwipeCarousel)
+			: _Orientation(Orient_Horizontal)
+			  , _Easing(EEasingFunc::ExpoOut)
+			  , _BlendExp(2.f)
+			  , _Speed(2.f)
+			  , _ScreenPercentValidation(0.15f)
+			  , _InitialIndex(0)
+		{
+			_Visibility = EVisibility::Visible;
+			_Clipping = EWidgetClipping::ClipToBounds;
+		}
+
+		/** The direction of the swipe. */
+		SLATE_ARGUMENT(EOrientation, Orientation)
+		/** Snap animation interpolation method */
+		SLATE_ARGUMENT(EEasingFunc::Type, Easing)
+		/** Exponent of the interpolation function of the snap animation */
+		SLATE_ARGUMENT(float, BlendExp)
+		/** Speed coefficient of the snap animation */
+		SLATE_ARGUMENT(float, Speed)
+		/** Minimum percent of the page the user must travel to validate a swipe */
+		SLATE_ARGUMENT(float, ScreenPercentValidation)
+		/** Logical index of the page shown first */
+		SLATE_ARGUMENT(int64, InitialIndex)
+		/** Fills the pages, see FOnGenerateCarouselPage */
+		SLATE_EVENT(FOnGenerateCarouselPage, OnGeneratePage)
+		/** Called when the current logical page changes */
+		SLATE_EVENT(FOnCarouselPageChanged, OnPageChanged)
+	SLATE_END_ARGS()
+
+	SSwipeCarousel();
+
+	void Construct(const FArguments& InArgs);
+
+	/** @return the logical index of the page currently shown. */
+	int64 GetCurrentIndex() const
+	{
+		return CurrentIndex;
+	}
+
+	/** Moves to the page InIndex, animating only when it is next to the current page. */
+	void SetCurrentIndex(int64 InIndex, bool bAnimate);
+
+	/** Animates to the next page. */
+	void Next();
+
+	/** Animates to the previous page. */
+	void Previous();
+
+	/** Asks OnGeneratePage to rebind the three live pages, call it after the data behind the pages changed. */
+	void RefreshPages();
+
+	//~ Begin SWidget Interface
+	virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+	virtual FChildren* GetChildren() override;
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual FReply OnPreviewMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnTouchEnded(const FGeometry& MyGeometry, const FPointerEvent& InTouchEvent) override;
+	virtual void OnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent) override;
+	//~ End SWidget Interface
+
+protected:
+	//~ Begin SWidget Interface
+	virtual FVector2D ComputeDesiredSize(float) const override;
+	//~ End SWidget Interface
+
+private:
+	static constexpr int32 RingSize = 3;
+
+	/** @return the ring slot showing the page InPageOffset pages away from the current one, in [-1, 1]. */
+	int32 GetRingSlot(int32 InPageOffset) const
+	{
+		return (RingHead + InPageOffset + RingSize) % RingSize;
+	}
+
+	/** Size of a page along the orientation, as of the last tick. */
+	float GetPageExtent() const;
+
+	/** Makes the ring slot InRingSlot show the page InLogicalIndex, asking OnGeneratePage when it changed. */
+	void BindRingSlot(int32 InRingSlot, int64 InLogicalIndex, bool bForce = false);
+
+	/** Moves the current page by one in InDirection, rotating the ring so only one slot is rebound. */
+	void StepBy(int32 InDirection);
+
+	/** Translation of the current page along the orientation, positive when the previous page comes in. */
+	float GetAxisOffset() const
+	{
+		return Orientation == Orient_Horizontal ? PageDrag.GetOffset().X : PageDrag.GetOffset().Y;
+	}
+
+	/** @return the translation of the pages for InAxisOffset along the orientation. */
+	FVector2f MakeOffset(float InAxisOffset) const
+	{
+		return Orientation == Orient_Horizontal ? FVector2f(InAxisOffset, 0.f) : FVector2f(0.f, InAxisOffset);
+	}
+
+	/** Picks the page to snap to at the end of a drag. */
+	void OnDragReleased();
+
+	TSlotlessChildren<SBox> Children;
+
+	/** Logical index shown by each ring slot. */
+	int64 RingIndex[RingSize];
+
+	/** Content of each ring slot, handed back to OnGeneratePage to be rebound. */
+	TSharedPtr<SWidget> RingContent[RingSize];
+
+	/** Ring slot of the current page. */
+	int32 RingHead;
+
+	int64 CurrentIndex;
+
+	/** Touch tracking, translation of the pages and snap animation. */
+	FSwipePageDrag PageDrag;
+
+	float LastPageExtent;
+
+	EOrientation Orientation;
+	float ScreenPercentValidation;
+
+	FOnGenerateCarouselPage OnGeneratePage;
+	FOnCarouselPageChanged OnPageChanged;
+};
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Layout/Children.h"
+#include "Slate/Framework/Layout/SwipePageDrag.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SPanel.h"
+
+/**
+ * Called to fill a page of the grid.
+ * @param Cell         Column (X) and row (Y) of the page.
+ * @param RecycledPage The widget previously shown by the same realized slot, null the first time. Rebinding and
+ *                     returning it avoids creating a new widget for every page.
+ */
+DECLARE_DELEGATE_RetVal_TwoParams(TSharedRef<SWidget>, FOnGenerateGridPage, FIntPoint /*Cell*/, TSharedPtr<SWidget> /*RecycledPage*/);
+
+DECLARE_DELEGATE_OneParam(FOnGridPageChanged, FIntPoint /*Cell*/);
+
+/**
+ * A paged grid that swipes on both axes. Each gesture is locked to the axis it started on and snaps to the next
+ * column or row with the same easing settings as SSwipeBox. Only the current page and its eight neighbours are
+ * realized, in a fixed set of slots that are rebound as the current page moves, so the cost does not depend on the
+ * number of rows and columns.
+ */
+class MOBILEWIDGETSWIPE_API SSwipeGrid : public SPanel
+{
+public:
+	SLATE_BEGIN_ARGS(SSwipeGrid)
+			: _NumColumns(1)
+			  , _NumRows(1)
+			  , _Easing(EEasingFunc::ExpoOut)
+			  , _BlendExp(2.f)
+			  , _Speed(2.f)
+			  , _ScreenPercentValidation(0.15f)
+			  , _InitialCell(0, 0)
+		{
+			_Visibility = EVisibility::Visible;
+			_Clipping = EWidgetClipping::ClipToBounds;
+		}
+
+		/** Number of pages along the horizontal axis */
+		SLATE_ARGUMENT(int32, NumColumns)
+		/** Number of pages along the vertical axis */
+		SLATE_ARGUMENT(int32, NumRows)
+		/** Snap animation interpolation method */
+		SLATE_ARGUMENT(EEasingFunc::Type, Easing)
+		/** Exponent of the interpolation function of the snap animation */
+		SLATE_ARGUMENT(float, BlendExp)
+		/** Speed coefficient of the snap animation */
+		SLATE_ARGUMENT(float, Speed)
+		/** Minimum percent of the page the user must travel to validate a swipe */
+		SLATE_ARGUMENT(float, ScreenPercentValidation)
+		/** Page shown first */
+		SLATE_ARGUMENT(FIntPoint, InitialCell)
+		/** Fills the pages, see FOnGenerateGridPage */
+		SLATE_EVENT(FOnGenerateGridPage, OnGeneratePage)
+		/** Called when the current page changes */
+		SLATE_EVENT(FOnGridPageChanged, OnPageChanged)
+	SLATE_END_ARGS()
+
+	SSwipeGrid();
+
+	void Construct(const FArguments& InArgs);
+
+	/** @return the column (X) and row (Y) of the page currently shown. */
+	FIntPoint GetCurrentCell() const
+	{
+		return CurrentCell;
+	}
+
+	/** Moves to the page InCell, animating only when it is next to the current page on one axis. */
+	void SetCurrentCell(FIntPoint InCell, bool bAnimate);
+
+	/** Changes the size of the grid, the current page is clamped to it and the realized pages are rebound. */
+	void SetGridSize(int32 InNumColumns, int32 InNumRows);
+
+	int32 GetNumColumns() const
+	{
+		return NumColumns;
+	}
+
+	int32 GetNumRows() const
+	{
+		return NumRows;
+	}
+
+	/** Asks OnGeneratePage to rebind every realized page, call it after the data behind the pages changed. */
+	void RefreshPages();
+
+	//~ Begin SWidget Interface
+	virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+	virtual FChildren* GetChildren() override;
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual FReply OnPreviewMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnTouchEnded(const FGeometry& MyGeometry, const FPointerEvent& InTouchEvent) override;
+	virtual void OnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent) override;
+	//~ End SWidget Interface
+
+protected:
+	//~ Begin SWidget Interface
+	virtual FVector2D ComputeDesiredSize(float) const override;
+	//~ End SWidget Interface
+
+private:
+	/** Pages realized around the current one on each side, on both axes. */
+	static constexpr int32 RealizeRadius = 1;
+	static constexpr int32 NumRealizedSlots = (2 * RealizeRadius + 1) * (2 * RealizeRadius + 1);
+
+	/** What a realized slot currently shows. */
+	struct FRealizedPage
+	{
+		/** Cell shown by the slot, INDEX_NONE when the slot is unused. */
+		FIntPoint Cell = FIntPoint(INDEX_NONE, INDEX_NONE);
+		TSharedPtr<SWidget> Content;
+	};
+
+	bool IsValidCell(const FIntPoint& InCell) const
+	{
+		return InCell.X >= 0 && InCell.X < NumColumns && InCell.Y >= 0 && InCell.Y < NumRows;
+	}
+
+	/** Rebinds the realized slots to the pages around the current one, keeping the slots already showing one. */
+	void RealizePages(bool bForce);
+
+	/** Makes the slot InSlotIndex show the page InCell, or empties it when InCell is not part of the grid. */
+	void BindSlot(int32 InSlotIndex, const FIntPoint& InCell);
+
+	/** Moves the current page by InStep, which is one page along a single axis. */
+	void StepBy(const FIntPoint& InStep);
+
+	/** Picks the page to snap to at the end of a drag along InAxis. */
+	void OnDragReleased(EOrientation InAxis);
+
+	TSlotlessChildren<SBox> Children;
+
+	FRealizedPage RealizedPages[NumRealizedSlots];
+
+	int32 NumColumns;
+	int32 NumRows;
+
+	FIntPoint CurrentCell;
+
+	/** Touch tracking, translation of the current page and snap animation. Each gesture locks the axis it started on. */
+	FSwipePageDrag PageDrag;
+
+	FVector2f LastPageSize;
+
+	float ScreenPercentValidation;
+
+	FOnGenerateGridPage OnGeneratePage;
+	FOnGridPageChanged OnPageChanged;
+};
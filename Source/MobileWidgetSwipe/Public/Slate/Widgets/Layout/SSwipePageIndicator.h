@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateColor.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SLeafWidget.h"
+
+struct FSlateBrush;
+
+DECLARE_DELEGATE_OneParam(FOnPageIndicatorClicked, int32 /*PageIndex*/);
+
+/**
+ * Shows the pages of a swipe widget as a row of dots, painted as boxes of a single brush in one pass without child
+ * widgets. The dot of the current page takes the active color, blending into the next one as the page position
+ * moves between them. When there are more pages than MaxVisibleDots, a window of dots slides along with the current
+ * page and the dots at its edges shrink to hint at the pages beyond. Tapping a dot reports its page.
+ */
+class MOBILEWIDGETSWIPE_API SSwipePageIndicator : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSwipePageIndicator)
+			: _NumPages(0)
+			  , _PagePosition(0.f)
+			  , _Orientation(Orient_Horizontal)
+			  , _DotBrush(nullptr)
+			  , _DotSize(8.f, 8.f)
+			  , _DotSpacing(8.f)
+			  , _MaxVisibleDots(9)
+			  , _DotColor(FLinearColor(1.f, 1.f, 1.f, 0.4f))
+			  , _ActiveDotColor(FLinearColor::White)
+		{
+			_Visibility = EVisibility::Visible;
+		}
+
+		/** Number of pages, one dot each */
+		SLATE_ARGUMENT(int32, NumPages)
+		/** Index of the current page, the fraction is the progress toward the next page */
+		SLATE_ARGUMENT(float, PagePosition)
+		/** Direction the dots are laid along */
+		SLATE_ARGUMENT(EOrientation, Orientation)
+		/** Brush of every dot, the plugin round dot when null */
+		SLATE_ARGUMENT(const FSlateBrush*, DotBrush)
+		/** Size of a dot */
+		SLATE_ARGUMENT(FVector2f, DotSize)
+		/** Space between two dots */
+		SLATE_ARGUMENT(float, DotSpacing)
+		/** Above this number of pages only a sliding window of dots is shown */
+		SLATE_ARGUMENT(int32, MaxVisibleDots)
+		/** Color of the dots of the other pages */
+		SLATE_ARGUMENT(FSlateColor, DotColor)
+		/** Color of the dot of the current page */
+		SLATE_ARGUMENT(FSlateColor, ActiveDotColor)
+		/** Called when the user taps a dot */
+		SLATE_EVENT(FOnPageIndicatorClicked, OnPageClicked)
+	SLATE_END_ARGS()
+
+	SSwipePageIndicator();
+
+	void Construct(const FArguments& InArgs);
+
+	int32 GetNumPages() const
+	{
+		return NumPages;
+	}
+
+	void SetNumPages(int32 InNumPages);
+
+	float GetPagePosition() const
+	{
+		return PagePosition;
+	}
+
+	/** Sets the current page, its fraction being the progress toward the next page. Only repaints the dots. */
+	void SetPagePosition(float InPagePosition);
+
+	void SetOrientation(EOrientation InOrientation);
+	void SetDotBrush(const FSlateBrush* InDotBrush);
+	void SetDotSize(FVector2f InDotSize);
+	void SetDotSpacing(float InDotSpacing);
+	void SetMaxVisibleDots(int32 InMaxVisibleDots);
+	void SetDotColor(const FSlateColor& InDotColor);
+	void SetActiveDotColor(const FSlateColor& InActiveDotColor);
+
+	//~ Begin SWidget Interface
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	                      FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+	                      bool bParentEnabled) const override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual void OnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent) override;
+	//~ End SWidget Interface
+
+protected:
+	//~ Begin SWidget Interface
+	virtual FVector2D ComputeDesiredSize(float) const override;
+	//~ End SWidget Interface
+
+private:
+	int32 GetNumVisibleDots() const
+	{
+		return FMath::Min(NumPages, MaxVisibleDots);
+	}
+
+	/** @return the page, possibly fractional, shown by the first dot slot of the window. */
+	float GetWindowStart() const;
+
+	/** @return the page of the dot nearest to InLocalPosition, INDEX_NONE when there are no pages or it is outside the dots. */
+	int32 GetPageAtLocalPosition(const FGeometry& InGeometry, const FVector2f& InLocalPosition) const;
+
+	const FSlateBrush* GetDotBrush() const;
+
+	int32 NumPages;
+	float PagePosition;
+	EOrientation Orientation;
+	const FSlateBrush* DotBrush;
+	FVector2f DotSize;
+	float DotSpacing;
+	int32 MaxVisibleDots;
+	FSlateColor DotColor;
+	FSlateColor ActiveDotColor;
+
+	/** Pointer that pressed the widget, a release of the same pointer over it is a tap. */
+	TOptional<int32> PressedPointerIndex;
+
+	FOnPageIndicatorClicked OnPageClicked;
+};
@@ -12,7 +12,13 @@
 #include "Containers/Ticker.h"
 #include "SwipeBox.generated.h"
 
+class USwipeBoxSlot;
+class UUserWidget;
+class UWidgetAnimation;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUserSwipeedEvent, int32, CurrentPage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPageAssetsLoadedEvent, int32, PageIndex, UWidget*, PageContent);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPageLifecycleEvent, int32, PageIndex, UWidget*, PageContent);
 
 /**
  * An arbitrary Swipeable collection of widgets.  Great for presenting 10-100 widgets in a list.  Doesn't support virtualization.
@@ -239,6 +245,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Swipe|Page Transition")
 	int GetCurrentPage() const;
 
+	/** @return the page on screen, the fraction being the progress of the swipe toward the next page. Drives a page indicator. */
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Page Transition")
+	float GetPagePosition() const;
+
 	/**
 	 * @param ThrowEvent true to send the change event
 	 * @param PlayAnimation true to play animation while changing page, false to instantly change page.
@@ -281,12 +291,126 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Swipe")
 	void EndInertialSwipeing();
 
+	/**
+	 * Gets the delay between a touch move and the layout pass that applies the resulting Swipe offset.
+	 * @param Percentile in [0, 100], e.g. 50, 95 or 99.
+	 * @return The latency in milliseconds, 0 if nothing has been recorded.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Profiling")
+	float GetInputLatencyPercentile(float Percentile) const;
+
+	/** Gets the number of touch moves recorded in the input latency histogram. */
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Profiling")
+	int32 GetInputLatencySampleCount() const;
+
+	/** Clears the input latency histogram. */
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Profiling")
+	void ResetInputLatency();
+
+	/**
+	 * Forgets the cached first focusable widget of a page used by gamepad and keyboard navigation.
+	 * Call it after adding focusable content to a page, or after showing hidden content of a page.
+	 * @param PageIndex The page to invalidate, -1 for every page.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Navigation")
+	void InvalidateKeyboardFocusCache(int32 PageIndex = -1);
+
+	/**
+	 * Adds several children at the end of the box. The live Slate widget receives every new page in a single
+	 * insertion and layout invalidation, prefer it over repeated AddChild calls to fill a box.
+	 * @return the slots created, in the order of Contents. Null contents are skipped.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Panel")
+	TArray<USwipeBoxSlot*> AddChildren(const TArray<UWidget*>& Contents);
+
+	/**
+	 * Removes several children, updating the live Slate widget once.
+	 * @return the number of children removed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Panel")
+	int32 RemoveChildren(const TArray<UWidget*>& Contents);
+
+	/**
+	 * Replaces every child of the box by Contents, updating the live Slate widget once.
+	 * @return the slots created, in the order of Contents. Null contents are skipped.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Panel")
+	TArray<USwipeBoxSlot*> ReplaceChildren(const TArray<UWidget*>& Contents);
+
+	/**
+	 * Makes the children match Contents, identified by Keys, touching only what changed. Children whose key is kept
+	 * with the same content keep their page, the others are removed, and new keys get a new slot. The current page
+	 * is re-anchored by key, so inserting pages before it neither moves nor rebuilds it.
+	 * @param Keys Unique, non None, identity of each content.
+	 * @param Contents The content of each page, same length as Keys.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Panel")
+	void SyncChildren(const TArray<FName>& Keys, const TArray<UWidget*>& Contents);
+
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Streaming")
+	void SetStreamingRadius(int32 NewStreamingRadius);
+
+	int32 GetStreamingRadius() const;
+
+	/** Requests the streamed assets of InSlot again when its page is within StreamingRadius, after they changed. */
+	void RefreshSlotStreaming(USwipeBoxSlot* InSlot);
+
+	/**
+	 * When set, pages outside the view are neither ticked, painted nor hit tested, and the animations of user widget
+	 * pages are paused until they come back. Off-screen pages cannot take focus.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Lifecycle")
+	void SetSuspendOffscreenPages(bool bNewSuspendOffscreenPages);
+
+	bool IsSuspendOffscreenPages() const;
+
+	/** When set, the pages are not hit tested, and their content gets no hover events, while the user drags them. */
+	UFUNCTION(BlueprintCallable, Category = "Swipe")
+	void SetSuspendPageHitTestWhileSwiping(bool bNewSuspendPageHitTestWhileSwiping);
+
+	bool IsSuspendPageHitTestWhileSwiping() const;
+
+	/**
+	 * When set, pages start as empty placeholders and their content is built over the next frames, the current page
+	 * first then the others by distance, within PageBuildBudgetMs per frame. The Slate resources of removed pages are
+	 * released over frames the same way, clear the children before closing the box to spread its teardown too.
+	 * Turning it off builds the remaining pages at once.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Time Slicing")
+	void SetTimeSlicePageBuild(bool bNewTimeSlicePageBuild);
+
+	bool IsTimeSlicePageBuild() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Swipe|Time Slicing")
+	void SetPageBuildBudgetMs(float NewPageBuildBudgetMs);
+
+	float GetPageBuildBudgetMs() const;
+
+	/** Releases at once the Slate resources of the removed pages still waiting in the teardown queue of every box. */
+	static void FlushPageTeardown();
+
 public:
 
 	/** Called when the Swipe has changed */
 	UPROPERTY(BlueprintAssignable, Category = "Button|Event")
 	FOnUserSwipeedEvent OnUserSwipeed;
 
+	/** Called when the streamed assets of a page finished loading, see USwipeBoxSlot::StreamedAssets. */
+	UPROPERTY(BlueprintAssignable, Category = "Swipe|Streaming")
+	FOnPageAssetsLoadedEvent OnPageAssetsLoaded;
+
+	/** Called when a page is about to enter the view, before it is laid out. */
+	UPROPERTY(BlueprintAssignable, Category = "Swipe|Lifecycle")
+	FOnPageLifecycleEvent OnPageWillAppear;
+
+	/** Called once a page has been laid out in the view. */
+	UPROPERTY(BlueprintAssignable, Category = "Swipe|Lifecycle")
+	FOnPageLifecycleEvent OnPageDidAppear;
+
+	/** Called when a page that appeared has left the view. */
+	UPROPERTY(BlueprintAssignable, Category = "Swipe|Lifecycle")
+	FOnPageLifecycleEvent OnPageDidDisappear;
+
 	/**
 	 * Updates the Swipe offset of the Swipebox.
 	 * @param NewSwipeOffset is in Slate Units.
@@ -343,6 +467,10 @@ public:
 	virtual void OnDescendantSelectedByDesigner( UWidget* DescendantWidget ) override;
 	virtual void OnDescendantDeselectedByDesigner( UWidget* DescendantWidget ) override;
 	//~ End UWidget Interface
+
+	//~ Begin UObject Interface
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	//~ End UObject Interface
 #endif
 
 protected:
@@ -355,6 +483,48 @@ protected:
 
 	void SlateHandleUserSwipeed(int32 CurrentPage);
 
+	/**
+	 * Requests the streamed assets of the pages within StreamingRadius of the current page, closest first and, at the
+	 * same distance, the page in the direction of the last swipe first. Releases the assets of the pages that left
+	 * that window since the last update, the pages further away are not visited.
+	 */
+	void UpdatePageStreaming();
+
+	/** Releases the streamed assets of every page. */
+	void ReleasePageStreaming();
+
+	void HandlePageAssetsLoaded(TWeakObjectPtr<USwipeBoxSlot> LoadedSlot);
+
+	/** @return the arguments of the Slate slot of InSlot, with a placeholder for its content when time slicing. */
+	SSwipeBox::FSlot::FSlotArguments MakePageSlotArguments(USwipeBoxSlot* InSlot);
+
+	bool ShouldTimeSlicePageBuild() const;
+
+	/** Starts the page build ticker if some pages are still placeholders. */
+	void SchedulePageBuild();
+
+	/** Builds the placeholders closest to the current page until the frame budget is spent. */
+	bool TickPageBuild(float DeltaTime);
+
+	/** Builds every remaining placeholder at once. */
+	void BuildPendingPages();
+
+	void SlateHandlePageWillAppear(int32 PageIndex);
+	void SlateHandlePageDidAppear(int32 PageIndex);
+	void SlateHandlePageDidDisappear(int32 PageIndex);
+
+	/** Pauses the playing animations of a user widget page, or resumes the ones paused by a previous call. */
+	void SetPageAnimationsPaused(UWidget* PageContent, bool bPaused);
+
+	/** Resumes every animation paused by SetPageAnimationsPaused. */
+	void ResumePageAnimations();
+
+	/** Adds every content to Slots while the Slate widget updates are deferred. */
+	TArray<USwipeBoxSlot*> AddChildrenDeferred(const TArray<UWidget*>& Contents);
+
+	/** Applies the slot changes recorded while bDeferSlateSlotUpdates was set to the live Slate widget. */
+	void FlushDeferredSlateSlotUpdates(bool bReplaceAll);
+
 	// Initialize IsFocusable in the constructor before the SWidget is constructed.
 	void InitBackPadSwipeing(bool InBackPadSwipeing);
 	// Initialize IsFocusable in the constructor before the SWidget is constructed.
@@ -368,6 +538,93 @@ protected:
 
 	TSharedPtr<class SSwipeBox> MySwipeBox;
 
+	/** Values pushed to MySwipeBox by the last SynchronizeProperties, only the properties that differ are pushed again. */
+	struct FSyncedProperties
+	{
+		float SwipeOffset = 0.f;
+		EOrientation Orientation = Orient_Vertical;
+		ESlateVisibility SwipeBarVisibility = ESlateVisibility::Visible;
+		FVector2D SwipeBarThickness = FVector2D::ZeroVector;
+		FMargin SwipeBarPadding;
+		bool AlwaysShowSwipeBar = false;
+		bool AlwaysShowSwipeBarTrack = false;
+		bool AllowOverSwipe = false;
+		bool bAllowRightClickDragSwipeing = false;
+		bool AllowStickySwipe = false;
+		EConsumeMouseWheel ConsumeMouseWheel = EConsumeMouseWheel::WhenScrollingPossible;
+		bool bAnimateWheelSwipeing = false;
+		float WheelSwipeMultiplier = 1.f;
+		/** The styles are not copied, their change serials tell whether they were edited since. */
+		uint32 WidgetStyleSerial = 0;
+		uint32 WidgetBarStyleSerial = 0;
+	};
+
+	/** Bumped on every change of WidgetStyle and WidgetBarStyle, through the setters or the details panel. */
+	uint32 WidgetStyleSerial = 0;
+	uint32 WidgetBarStyleSerial = 0;
+
+	/** Unset until the first synchronization of the current Slate widget, which then pushes everything. */
+	TOptional<FSyncedProperties> SyncedProperties;
+
+	/** Records InValue as pushed to the Slate widget by a setter, so SynchronizeProperties does not push it again. */
+	template <typename TValue>
+	void MarkSynced(TValue FSyncedProperties::*InMember, const typename TIdentity<TValue>::Type& InValue)
+	{
+		if (SyncedProperties.IsSet())
+		{
+			SyncedProperties.GetValue().*InMember = InValue;
+		}
+	}
+
+	/** Set while a batch operation runs, OnSlotAdded and OnSlotRemoved then record the changes instead of applying them. */
+	bool bDeferSlateSlotUpdates = false;
+
+	/** Slots added while bDeferSlateSlotUpdates was set. */
+	TArray<TObjectPtr<USwipeBoxSlot>> DeferredAddedSlots;
+
+	/** Slate widgets of the slots removed while bDeferSlateSlotUpdates was set. */
+	TArray<TSharedRef<SWidget>> DeferredRemovedWidgets;
+
+	/** Current page of the last streaming update, INDEX_NONE before the first one. */
+	int32 LastStreamingPage = INDEX_NONE;
+
+	/** Sign of the last page change, favours the pages the user is swiping toward. */
+	int32 StreamingDirection = 0;
+
+	/** Pages of the last streaming update, whose assets are requested. Its successor is built in the scratch array. */
+	TArray<TWeakObjectPtr<USwipeBoxSlot>> StreamedPageSlots;
+	TArray<TWeakObjectPtr<USwipeBoxSlot>> StreamedPageScratch;
+
+	/** Builds the placeholder pages over frames, see bTimeSlicePageBuild. */
+	FTSTicker::FDelegateHandle PageBuildTickHandle;
+
+	/** Placeholders TickPageBuild orders by priority, kept between frames to reuse its allocation. */
+	TArray<TPair<int32, USwipeBoxSlot*>> PendingPageScratch;
+
+	/** Animations paused while their page was off-screen, by page. */
+	TMap<TWeakObjectPtr<UUserWidget>, TArray<TWeakObjectPtr<UWidgetAnimation>>> PausedPageAnimations;
+
+private:
+	/** Pages further than this from the current page do not keep their streamed assets loaded. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetStreamingRadius", Category = "Swipe|Streaming", meta = (AllowPrivateAccess = "true", ClampMin = "0"))
+	int32 StreamingRadius = 1;
+
+	/** Skips the tick, paint and hit test of pages outside the view, and pauses the animations of user widget pages. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter = "IsSuspendOffscreenPages", Setter, BlueprintSetter = "SetSuspendOffscreenPages", Category = "Swipe|Lifecycle", meta = (AllowPrivateAccess = "true"))
+	bool bSuspendOffscreenPages = false;
+
+	/** Stops hit testing the pages from the start of a touch drag until they settle, hovered content gets no events in between. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter = "IsSuspendPageHitTestWhileSwiping", Setter, BlueprintSetter = "SetSuspendPageHitTestWhileSwiping", Category = "Swipe", meta = (AllowPrivateAccess = "true"))
+	bool bSuspendPageHitTestWhileSwiping = false;
+
+	/** Builds the pages over several frames instead of all in RebuildWidget, and tears removed pages down the same way. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter = "IsTimeSlicePageBuild", Setter, BlueprintSetter = "SetTimeSlicePageBuild", Category = "Swipe|Time Slicing", meta = (AllowPrivateAccess = "true"))
+	bool bTimeSlicePageBuild = false;
+
+	/** Time per frame spent building or tearing down pages when time slicing, at least one page is handled each frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetPageBuildBudgetMs", Category = "Swipe|Time Slicing", meta = (AllowPrivateAccess = "true", ClampMin = "0", Units = "ms"))
+	float PageBuildBudgetMs = 2.f;
+
 protected:
 	//~ Begin UWidget Interface
 	virtual TSharedRef<SWidget> RebuildWidget() override;
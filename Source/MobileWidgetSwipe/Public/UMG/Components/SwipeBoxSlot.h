@@ -10,6 +10,7 @@
 #include "Components/SlateWrapperTypes.h"
 #include "Slate/Widgets/Layout/SSwipeBox.h"
 #include "Components/PanelSlot.h"
+#include "Engine/StreamableManager.h"
 
 #include "SwipeBoxSlot.generated.h"
 
@@ -25,6 +26,17 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, Category = "Layout|SwipeBox Slot", meta = (AllowPrivateAccess = "true", DisplayAfter = "Padding"))
 	FSlateChildSize Size;
 
+	/** Stable identity of the page, lets USwipeBox::SyncChildren keep the page when the children are reordered. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, Category = "Layout|SwipeBox Slot", meta = (AllowPrivateAccess = "true"))
+	FName Key;
+
+	/**
+	 * Assets the page needs, loaded asynchronously by the USwipeBox while the page is within its streaming radius of
+	 * the current page. Reference them softly in the page content so opening the box does not load every page.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, Category = "Layout|SwipeBox Slot", meta = (AllowPrivateAccess = "true"))
+	TArray<TSoftObjectPtr<UObject>> StreamedAssets;
+
 public:
 	
 	UE_DEPRECATED(5.1, "Direct access to Padding is deprecated. Please use the getter or setter.")
@@ -53,6 +65,29 @@ public:
 
 	void SetSize(FSlateChildSize InSize);
 
+	FName GetKey() const;
+
+	/** Changing the key of a live slot rebuilds its page at the next USwipeBox::SyncChildren. */
+	void SetKey(FName InKey);
+
+	const TArray<TSoftObjectPtr<UObject>>& GetStreamedAssets() const;
+
+	/** Releases the previous assets, the owning box requests the new ones right away if the page is near the current one. */
+	void SetStreamedAssets(const TArray<TSoftObjectPtr<UObject>>& InStreamedAssets);
+
+	/**
+	 * Starts the async load of StreamedAssets, or raises the priority of a load in flight.
+	 * @param InPriority Loads with a higher priority are serviced first.
+	 * @param InOnLoaded Called once every asset is loaded, also when they already were.
+	 */
+	void RequestStreamedAssets(TAsyncLoadPriority InPriority, FStreamableDelegate InOnLoaded);
+
+	/** Releases the handle keeping StreamedAssets loaded, cancelling the load if it did not complete. */
+	void ReleaseStreamedAssets();
+
+	/** @return true when StreamedAssets were requested and are all loaded. */
+	bool AreStreamedAssetsLoaded() const;
+
 	EHorizontalAlignment GetHorizontalAlignment() const;
 
 	UFUNCTION(BlueprintCallable, Category="Layout|SwipeBox Slot")
@@ -72,10 +107,40 @@ public:
 	/** Builds the underlying FSlot for the Slate layout panel. */
 	void BuildSlot(TSharedRef<SSwipeBox> SwipeBox);
 
+	/**
+	 * Makes the arguments of the underlying FSlot, to add several slots to the Slate panel at once.
+	 * @param bBuildContent false to put a placeholder in the slot instead of the content, see BuildContent.
+	 */
+	SSwipeBox::FSlot::FSlotArguments MakeSlotArguments(bool bBuildContent = true);
+
+	/** Replaces the placeholder in the live slot of SwipeBox by the content widget. @return false when there was no placeholder. */
+	bool BuildContent(SSwipeBox& SwipeBox);
+
+	/** @return false while the live slot holds a placeholder instead of the content. */
+	bool IsContentBuilt() const;
+
+	/** @return the widget in the live slot, the placeholder until the content is built. */
+	TSharedPtr<SWidget> GetSlotWidget() const;
+
 	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 
+	/** Keeps the Slate resources of the content on the next release, the swipe box releases them in a later frame. */
+	void DeferContentRelease();
+
 private:
 
 	/** A raw pointer to the slot to allow us to adjust the size, padding...etc at runtime. */
 	SSwipeBox::FSlot* Slot;
+
+	/** Holds the place of the content in the live slot until BuildContent. */
+	TSharedPtr<SWidget> Placeholder;
+
+	/** Set by DeferContentRelease. */
+	bool bDeferContentRelease = false;
+
+	/** Keeps StreamedAssets loaded while the page is near the current one. */
+	TSharedPtr<FStreamableHandle> StreamingHandle;
+
+	/** Priority StreamingHandle was requested with. */
+	TAsyncLoadPriority StreamingPriority = FStreamableManager::DefaultAsyncLoadPriority;
 };
@@ -0,0 +1,146 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Styling/SlateBrush.h"
+#include "Styling/SlateColor.h"
+#include "Components/Widget.h"
+#include "SwipePageIndicator.generated.h"
+
+class SSwipePageIndicator;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPageIndicatorClickedEvent, int32, PageIndex);
+
+/**
+ * Shows the pages of a swipe box as dots, with a sliding window of dots when there are many pages.
+ * Feed it the page position of the swipe box, tapping a dot reports its page.
+ */
+UCLASS()
+class MOBILEWIDGETSWIPE_API USwipePageIndicator : public UWidget
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+	/** Called when the user taps a dot */
+	UPROPERTY(BlueprintAssignable, Category = "Page Indicator|Event")
+	FOnPageIndicatorClickedEvent OnPageClicked;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetNumPages(int32 InNumPages);
+
+	int32 GetNumPages() const;
+
+	/** Sets the current page, its fraction being the progress toward the next page. Only repaints the dots. */
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetPagePosition(float InPagePosition);
+
+	float GetPagePosition() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetOrientation(EOrientation InOrientation);
+
+	EOrientation GetOrientation() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetDotBrush(const FSlateBrush& InDotBrush);
+
+	const FSlateBrush& GetDotBrush() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetDotSize(FVector2D InDotSize);
+
+	FVector2D GetDotSize() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetDotSpacing(float InDotSpacing);
+
+	float GetDotSpacing() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetMaxVisibleDots(int32 InMaxVisibleDots);
+
+	int32 GetMaxVisibleDots() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetDotColor(FSlateColor InDotColor);
+
+	FSlateColor GetDotColor() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Page Indicator")
+	void SetActiveDotColor(FSlateColor InActiveDotColor);
+
+	FSlateColor GetActiveDotColor() const;
+
+	//~ Begin UWidget Interface
+	virtual void SynchronizeProperties() override;
+	//~ End UWidget Interface
+
+	//~ Begin UVisual Interface
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+	//~ End UVisual Interface
+
+#if WITH_EDITOR
+	//~ Begin UWidget Interface
+	virtual const FText GetPaletteCategory() override;
+	//~ End UWidget Interface
+
+	//~ Begin UObject Interface
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	//~ End UObject Interface
+#endif
+
+private:
+	/** Number of pages, one dot each */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetNumPages", Category = "Page Indicator", meta = (AllowPrivateAccess = "true", ClampMin = "0"))
+	int32 NumPages = 0;
+
+	/** Index of the current page, the fraction is the progress toward the next page */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetPagePosition", Category = "Page Indicator", meta = (AllowPrivateAccess = "true", ClampMin = "0"))
+	float PagePosition = 0.f;
+
+	/** Direction the dots are laid along */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetOrientation", Category = "Page Indicator", meta = (AllowPrivateAccess = "true"))
+	TEnumAsByte<EOrientation> Orientation = Orient_Horizontal;
+
+	/** Brush of every dot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetDotBrush", Category = "Style", meta = (AllowPrivateAccess = "true"))
+	FSlateBrush DotBrush;
+
+	/** Size of a dot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetDotSize", Category = "Style", meta = (AllowPrivateAccess = "true"))
+	FVector2D DotSize = FVector2D(8.0, 8.0);
+
+	/** Space between two dots */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetDotSpacing", Category = "Style", meta = (AllowPrivateAccess = "true"))
+	float DotSpacing = 8.f;
+
+	/** Above this number of pages only a sliding window of dots is shown, the ones at its edges shrinking */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetMaxVisibleDots", Category = "Page Indicator", meta = (AllowPrivateAccess = "true", ClampMin = "1"))
+	int32 MaxVisibleDots = 9;
+
+	/** Color of the dots of the other pages */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetDotColor", Category = "Style", meta = (AllowPrivateAccess = "true"))
+	FSlateColor DotColor = FLinearColor(1.f, 1.f, 1.f, 0.4f);
+
+	/** Color of the dot of the current page */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Getter, Setter, BlueprintSetter = "SetActiveDotColor", Category = "Style", meta = (AllowPrivateAccess = "true"))
+	FSlateColor ActiveDotColor = FLinearColor::White;
+
+protected:
+	//~ Begin UWidget Interface
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	//~ End UWidget Interface
+
+	void SlateHandlePageClicked(int32 PageIndex);
+
+	TSharedPtr<SSwipePageIndicator> MyIndicator;
+
+	/**
+	 * The Slate widget points at DotBrush, so the brush cannot be compared with what it shows. DotBrushSerial is
+	 * bumped on every change of the brush, SyncedDotBrushSerial is the serial MyIndicator last repainted for.
+	 */
+	uint32 DotBrushSerial = 0;
+	uint32 SyncedDotBrushSerial = 0;
+};
@@ -4,12 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "Styling/SlateStyle.h"
+#include "Slate/Styling/SlateTypesExtension.h"
 
 /**  */
 class FWidgetSwipeStyle
 {
 public:
 
+	/** Registers the editor icons and the Slate style set. The Slate style set is otherwise created by the first Get. */
 	static MOBILEWIDGETSWIPE_API void Initialize();
 
 	static MOBILEWIDGETSWIPE_API void Shutdown();
@@ -17,13 +19,24 @@ public:
 	/** reloads textures used by slate renderer */
 	static MOBILEWIDGETSWIPE_API void ReloadTextures();
 
-	/** @return The Slate style set for the UMG Style */
+	/** @return The Slate style set for the UMG Style, created on the first call from the game thread. */
 	static MOBILEWIDGETSWIPE_API const TSharedPtr<ISlateStyle> Get();
 
 	static MOBILEWIDGETSWIPE_API FName GetStyleSetName();
 
+	/**
+	 * @return The "SwipeBox" style of the style set. Built on its own, without creating or registering the style set,
+	 * so class default objects can take it when the module loads. Safe to call from any thread.
+	 */
+	static MOBILEWIDGETSWIPE_API const FSwipeBoxStyle& GetDefaultSwipeBoxStyle();
+
+	/** @return The "SwipePageIndicator.Dot" brush of the style set, built like GetDefaultSwipeBoxStyle. */
+	static MOBILEWIDGETSWIPE_API const FSlateBrush& GetDefaultDotBrush();
+
 private:
 
+	static void InitializeSlateStyle();
+
 	static TSharedRef< class FSlateStyleSet > CreateIconsStyle();
 	static TSharedRef< class FSlateStyleSet > CreateSlateStyle();
 